@@ -0,0 +1,223 @@
+#include "analogclock.h"
+#include "st7789/shapes.h"
+
+#define Q14 16384
+#define HUB_RADIUS 3
+
+typedef struct {
+    u08 length;    // percent of the radius
+    u08 tail;      // percent of the radius behind the center
+    u16 halfWidth; // pixels << 14
+} HandShape_t;
+
+static const HandShape_t hands[CLOCK_HANDS] = {
+    [CLOCK_HAND_HOUR]   = {50, 0, Q14 * 2},
+    [CLOCK_HAND_MINUTE] = {78, 0, Q14 * 5 / 4},
+    [CLOCK_HAND_SECOND] = {90, 18, Q14 * 6 / 10},
+};
+
+typedef struct {
+    s32 x0, x1; // x0 > x1 when the row is empty
+} Span_t;
+
+static s32 floorDiv(s32 a, s32 b) {
+    return a / b - (a % b != 0 && (a < 0) != (b < 0));
+}
+
+static s32 ceilDiv(s32 a, s32 b) {
+    return -floorDiv(-a, b);
+}
+
+// Narrows the span to the x where lo <= slope * x + offset <= hi.
+static void narrow(Span_t* span, s32 slope, s32 offset, s32 lo, s32 hi) {
+    if(slope == 0) {
+        if(offset < lo || offset > hi) span->x1 = span->x0 - 1;
+        return;
+    }
+    if(slope < 0) {
+        s32 low = lo;
+        slope = -slope;
+        offset = -offset;
+        lo = -hi;
+        hi = -low;
+    }
+    s32 x0 = ceilDiv(lo - offset, slope);
+    s32 x1 = floorDiv(hi - offset, slope);
+    if(x0 > span->x0) span->x0 = x0;
+    if(x1 < span->x1) span->x1 = x1;
+}
+
+// Pixels of a bar from `from` to `to` pixels along the angle, on row dy of the
+// face. The bar is convex, so every row is one span, found from the two pairs
+// of parallel edges without touching the pixels.
+static Span_t barSpan(s16 angle, s32 from, s32 to, s32 halfWidth, s32 dy, s32 r) {
+    s32 ux = st7789_sin(angle);
+    s32 uy = -st7789_cos(angle);
+    Span_t span = {-r, r};
+    narrow(&span, ux, dy * uy, from * Q14, to * Q14);   // along the hand
+    narrow(&span, uy, -dy * ux, -halfWidth, halfWidth); // across it
+    return span;
+}
+
+static Span_t handSpan(const ClockFace_t* face, ClockHand_t hand, s16 angle, s32 dy) {
+    const HandShape_t* shape = &hands[hand];
+    return barSpan(angle, -(s32)face->r * shape->tail / 100, (s32)face->r * shape->length / 100, shape->halfWidth, dy, face->r);
+}
+
+static bool_t inSpan(const Span_t* span, s32 x) {
+    return x >= span->x0 && x <= span->x1;
+}
+
+static void dialSet(ClockFace_t* face, s32 dx, s32 dy) {
+    u32 x = dx + face->r;
+    face->dial[dy + face->r][x >> 5] |= 0x80000000u >> (x & 31);
+}
+
+static bool_t dialGet(const ClockFace_t* face, s32 dx, s32 dy) {
+    u32 x = dx + face->r;
+    return ((face->dial[dy + face->r][x >> 5] << (x & 31)) & 0x80000000u) != 0;
+}
+
+// Rim and the 60 marks, longer and wider ones at the hours.
+static void dialBuild(ClockFace_t* face) {
+    s32 r = face->r;
+    for(s32 dy = -r; dy <= r; dy++) {
+        for(u08 word = 0; word < CLOCK_FACE_WORDS; word++) face->dial[dy + r][word] = 0;
+        for(s32 dx = -r; dx <= r; dx++) {
+            s32 d2 = dx * dx + dy * dy;
+            if(d2 <= r * r + r && d2 >= (r - 2) * (r - 2)) dialSet(face, dx, dy);
+        }
+        for(u08 mark = 0; mark < 60; mark++) {
+            bool_t hour = mark % 5 == 0;
+            Span_t span = barSpan(mark * 6, r * (hour ? 80 : 87) / 100, r * 92 / 100, hour ? Q14 * 3 / 2 : Q14 * 3 / 4, dy, r);
+            for(s32 dx = span.x0; dx <= span.x1; dx++) dialSet(face, dx, dy);
+        }
+    }
+}
+
+static void handAngles(u32 daySeconds, s16* angle) {
+    u32 s = daySeconds % 43200;
+    angle[CLOCK_HAND_HOUR] = s / 120;            // a degree every two minutes
+    angle[CLOCK_HAND_MINUTE] = (s % 3600) / 10;  // a degree every ten seconds
+    angle[CLOCK_HAND_SECOND] = (s % 60) * 6;
+}
+
+// Sends pixels x0..x1 of row dy, top to bottom: hub, second, minute, hour hand, dial.
+static void composeRow(ClockFace_t* face, s32 dy, s32 x0, s32 x1, const Span_t* span, u16* line) {
+    u16 fg = face->shownFg, bg = face->shownBg, accent = face->shownAccent;
+    for(s32 x = x0; x <= x1; x++) {
+        u16 pixel;
+        if(x * x + dy * dy <= HUB_RADIUS * HUB_RADIUS + HUB_RADIUS) pixel = accent;
+        else if(inSpan(&span[CLOCK_HAND_SECOND], x)) pixel = accent;
+        else if(inSpan(&span[CLOCK_HAND_MINUTE], x) || inSpan(&span[CLOCK_HAND_HOUR], x)) pixel = fg;
+        else pixel = dialGet(face, x, dy) ? fg : bg;
+        line[x - x0] = pixel;
+    }
+    st7789_write_pixels(face->layer->lcd, line, x1 - x0 + 1);
+}
+
+static void drawAll(ClockFace_t* face) {
+    struct st7789* lcd = face->layer->lcd;
+    s32 r = face->r;
+    u16 line[CLOCK_FACE_SIZE];
+    st7789_select_window(lcd, face->cx - r, face->cy - r, face->cx + r, face->cy + r);
+    for(s32 dy = -r; dy <= r; dy++) {
+        Span_t span[CLOCK_HANDS];
+        for(u08 hand = 0; hand < CLOCK_HANDS; hand++) span[hand] = handSpan(face, hand, face->shownAngle[hand], dy);
+        composeRow(face, dy, -r, r, span, line);
+    }
+}
+
+// Old and new spans of every moved hand, merged per row so overlapping ones go out once.
+static void drawMoved(ClockFace_t* face, const s16* angle) {
+    struct st7789* lcd = face->layer->lcd;
+    s32 r = face->r;
+    u16 line[CLOCK_FACE_SIZE];
+    for(s32 dy = -r; dy <= r; dy++) {
+        Span_t span[CLOCK_HANDS];
+        Span_t dirty[2 * CLOCK_HANDS];
+        u08 count = 0;
+        for(u08 hand = 0; hand < CLOCK_HANDS; hand++) {
+            span[hand] = handSpan(face, hand, angle[hand], dy);
+            if(angle[hand] == face->shownAngle[hand]) continue;
+            Span_t old = handSpan(face, hand, face->shownAngle[hand], dy);
+            if(old.x0 <= old.x1) dirty[count++] = old;
+            if(span[hand].x0 <= span[hand].x1) dirty[count++] = span[hand];
+        }
+        // insertion sort by start, then merge touching spans
+        for(u08 i = 1; i < count; i++) {
+            Span_t s = dirty[i];
+            u08 j = i;
+            for(; j && dirty[j - 1].x0 > s.x0; j--) dirty[j] = dirty[j - 1];
+            dirty[j] = s;
+        }
+        for(u08 i = 0; i < count;) {
+            Span_t merged = dirty[i++];
+            while(i < count && dirty[i].x0 <= merged.x1 + 1) {
+                if(dirty[i].x1 > merged.x1) merged.x1 = dirty[i].x1;
+                i++;
+            }
+            st7789_select_window(lcd, face->cx + merged.x0, face->cy + dy, face->cx + merged.x1, face->cy + dy);
+            composeRow(face, dy, merged.x0, merged.x1, span, line);
+        }
+    }
+}
+
+void clockFaceInit(ClockFace_t* face, WidgetLayer_t* layer, s16 cx, s16 cy, u16 r) {
+    face->layer = layer;
+    face->cx = cx;
+    face->cy = cy;
+    face->r = r > CLOCK_FACE_RADIUS_MAX ? CLOCK_FACE_RADIUS_MAX : r;
+    face->visible = TRUE;
+    face->drawn = FALSE;
+    face->lastBytes = face->maxBytes = face->overBudget = 0;
+    dialBuild(face);
+}
+
+void clockFaceUpdate(ClockFace_t* face, u32 daySeconds) {
+    WidgetLayer_t* layer = face->layer;
+    s16 angle[CLOCK_HANDS];
+    handAngles(daySeconds, angle);
+    mutex_enter_blocking(&layer->lock);
+    if(!face->visible) {
+        mutex_exit(&layer->lock);
+        return;
+    }
+    u32 before = layer->lcd->tx_bytes;
+    bool_t themed = face->shownFg == layer->theme[THEME_FOREGROUND] && face->shownBg == layer->theme[THEME_BACKGROUND] &&
+                    face->shownAccent == layer->theme[THEME_ACCENT];
+    if(!face->drawn || !themed) {
+        face->shownFg = layer->theme[THEME_FOREGROUND];
+        face->shownBg = layer->theme[THEME_BACKGROUND];
+        face->shownAccent = layer->theme[THEME_ACCENT];
+        for(u08 hand = 0; hand < CLOCK_HANDS; hand++) face->shownAngle[hand] = angle[hand];
+        drawAll(face);
+        face->drawn = TRUE;
+    } else {
+        drawMoved(face, angle);
+        for(u08 hand = 0; hand < CLOCK_HANDS; hand++) face->shownAngle[hand] = angle[hand];
+        u32 bytes = layer->lcd->tx_bytes - before;
+        if(bytes > face->maxBytes) face->maxBytes = bytes;
+        if(bytes > CLOCK_FACE_BUDGET) face->overBudget++;
+    }
+    face->lastBytes = layer->lcd->tx_bytes - before;
+    mutex_exit(&layer->lock);
+}
+
+void clockFaceSetVisible(ClockFace_t* face, bool_t visible) {
+    WidgetLayer_t* layer = face->layer;
+    mutex_enter_blocking(&layer->lock);
+    if(!visible && face->visible && face->drawn) {
+        u16 size = 2 * face->r + 1;
+        st7789_draw_filled_rectangle(layer->lcd, face->cx - face->r, face->cy - face->r, size, size, layer->theme[THEME_BACKGROUND]);
+    }
+    if(visible != face->visible) face->drawn = FALSE;
+    face->visible = visible;
+    mutex_exit(&layer->lock);
+}
+
+void clockFaceInvalidate(ClockFace_t* face) {
+    mutex_enter_blocking(&face->layer->lock);
+    face->drawn = FALSE;
+    mutex_exit(&face->layer->lock);
+}
@@ -0,0 +1,47 @@
+#ifndef ANALOGCLOCK_H_
+#define ANALOGCLOCK_H_
+
+#include "widgets.h"
+
+// Analog face drawn next to the widgets of a layer, with its colors and lock.
+// The static dial is rasterized once into a 1 bpp cache. An update only rewrites
+// the rows where a moved hand was or is now, and each of those spans is composed
+// from the cached dial and the current hands, so nothing flickers and the bytes
+// per update stay around CLOCK_FACE_BUDGET instead of a full face every second.
+#define CLOCK_FACE_RADIUS_MAX 60
+#define CLOCK_FACE_SIZE (2 * CLOCK_FACE_RADIUS_MAX + 1)
+#define CLOCK_FACE_WORDS ((CLOCK_FACE_SIZE + 31) / 32)
+#define CLOCK_FACE_BUDGET 4096 // SPI bytes per incremental update, more is counted as over budget
+
+typedef enum {
+    CLOCK_HAND_HOUR,
+    CLOCK_HAND_MINUTE,
+    CLOCK_HAND_SECOND,
+    CLOCK_HANDS
+} ClockHand_t;
+
+typedef struct {
+    WidgetLayer_t* layer;
+    s16 cx, cy;
+    u16 r;
+    u32 dial[CLOCK_FACE_SIZE][CLOCK_FACE_WORDS]; // MSB first, set for dial pixels
+    bool_t visible;
+    bool_t drawn;
+    s16 shownAngle[CLOCK_HANDS];
+    u16 shownFg, shownBg, shownAccent;
+    u32 lastBytes;   // lcd tx_bytes of the last draw or update
+    u32 maxBytes;    // largest incremental update so far
+    u32 overBudget;  // incremental updates above CLOCK_FACE_BUDGET
+} ClockFace_t;
+
+// The face must lie on the panel, r is clamped to CLOCK_FACE_RADIUS_MAX.
+void clockFaceInit(ClockFace_t* face, WidgetLayer_t* layer, s16 cx, s16 cy, u16 r);
+// Seconds since midnight. Draws the whole face when it is not on screen yet or the
+// theme changed, otherwise only what the moved hands touch.
+void clockFaceUpdate(ClockFace_t* face, u32 daySeconds);
+// Hiding clears the face to the background and leaves the area to the widgets,
+// showing again draws the whole face at the next update.
+void clockFaceSetVisible(ClockFace_t* face, bool_t visible);
+void clockFaceInvalidate(ClockFace_t* face); // the next update draws the whole face
+
+#endif /*ANALOGCLOCK_H_*/
@@ -0,0 +1,224 @@
+#include <stdio.h>
+#include <pico/stdlib.h>
+#include <hardware/clocks.h>
+#include <hardware/spi.h>
+#ifdef XIP_PROFILE
+#include <hardware/structs/xip_ctrl.h>
+#endif
+
+#include "benchmark.h"
+#include "gpio.h"
+#include "sched.h"
+#include "clockprofile.h"
+#include "st7789/st7789.h"
+#include "st7789/blit.h"
+#include "st7789/dlist.h"
+#include "st7789/shapes.h"
+
+#define BENCH_ROUNDS 4 // repetitions inside each workload
+#define BENCH_GRID 8   // rectangles per row and column
+#define BENCH_LINES 64
+#define BENCH_IMAGE 32 // blit source size
+#ifdef ST7789_RAM_FUNCS
+#define BENCH_RAM_FUNCS 1
+#else
+#define BENCH_RAM_FUNCS 0
+#endif
+
+typedef struct {
+    const char* name;
+    void (*run)(struct st7789* lcd, const void* arg);
+    const void* arg;
+} BenchWorkload_t;
+
+static const u16 benchColors[BENCH_ROUNDS] = {ST_COLOR_RED, ST_COLOR_GREEN, ST_COLOR_BLUE, ST_COLOR_WHITE};
+static u08 benchImage[BENCH_IMAGE * BENCH_IMAGE];
+static u16 benchPalette[256];
+static u16 benchSource[BENCH_IMAGE * BENCH_IMAGE];
+static u16 gridList[BENCH_GRID * BENCH_GRID * (ST7789_DLIST_WINDOW + 2)];
+static struct st7789_dlist_block gridBlocks[BENCH_GRID * BENCH_GRID * 2 + 1];
+static struct st7789_dlist grid;
+
+static void benchFill(struct st7789* lcd, const void* arg) {
+    for(u08 i = 0; i < BENCH_ROUNDS; i++) st7789_fill(lcd, benchColors[i]);
+}
+
+static void benchRects(struct st7789* lcd, const void* arg) {
+    u16 w = lcd->width / BENCH_GRID, h = lcd->height / BENCH_GRID;
+    for(u08 i = 0; i < BENCH_ROUNDS; i++) {
+        for(u08 cell = 0; cell < BENCH_GRID * BENCH_GRID; cell++) {
+            u16 x = (cell % BENCH_GRID) * w, y = (cell / BENCH_GRID) * h;
+            st7789_draw_filled_rectangle(lcd, x + 1, y + 1, w - 2, h - 2, benchColors[(i + cell) % BENCH_ROUNDS]);
+        }
+    }
+}
+
+// The same grid recorded once and replayed, through the PIO transport when attached.
+static void benchDlistRects(struct st7789* lcd, const void* arg) {
+    u16 w = lcd->width / BENCH_GRID, h = lcd->height / BENCH_GRID;
+    st7789_dlist_begin(&grid, gridList, sizeof(gridList)/sizeof(gridList[0]), gridBlocks, sizeof(gridBlocks)/sizeof(gridBlocks[0]));
+    for(u08 cell = 0; cell < BENCH_GRID * BENCH_GRID; cell++) {
+        u16 x = (cell % BENCH_GRID) * w, y = (cell / BENCH_GRID) * h;
+        st7789_dlist_rect(&grid, x + 1, y + 1, w - 2, h - 2, benchColors[cell % BENCH_ROUNDS]);
+    }
+    if(!st7789_dlist_end(&grid)) return;
+    for(u08 i = 0; i < BENCH_ROUNDS; i++) st7789_dlist_replay(lcd, &grid);
+}
+
+static void benchText(struct st7789* lcd, const void* arg) {
+    const FontDef* font = arg;
+    char line[64];
+    u08 columns = (lcd->width - 1) / font->width; // st7789_write_string wraps at the last column
+    if(columns >= sizeof(line)) columns = sizeof(line) - 1;
+    for(u08 i = 0; i < columns; i++) line[i] = '!' + i % 94;
+    line[columns] = 0;
+    for(u08 i = 0; i < BENCH_ROUNDS; i++) {
+        for(u16 y = 0; y + font->height <= lcd->height; y += font->height) {
+            st7789_write_string(lcd, 0, y, line, *font, 1, benchColors[i], ST_COLOR_BLACK);
+        }
+    }
+}
+
+// Small font drawn twice as large, the glyph scaler instead of a bigger table
+static void benchScaledText(struct st7789* lcd, const void* arg) {
+    const FontDef* font = &Font_11x18;
+    char line[32];
+    u08 columns = (lcd->width - 1) / (2 * font->width);
+    if(columns >= sizeof(line)) columns = sizeof(line) - 1;
+    for(u08 i = 0; i < columns; i++) line[i] = '0' + i % 10;
+    line[columns] = 0;
+    for(u08 i = 0; i < BENCH_ROUNDS; i++) {
+        for(u16 y = 0; y + 2 * font->height <= lcd->height; y += 2 * font->height) {
+            st7789_write_string(lcd, 0, y, line, *font, 2, benchColors[i], ST_COLOR_BLACK);
+        }
+    }
+}
+
+// Center to border, all slopes
+static void benchLines(struct st7789* lcd, const void* arg) {
+    u16 cx = lcd->width / 2, cy = lcd->height / 2;
+    for(u08 i = 0; i < BENCH_LINES; i++) {
+        u16 side = i / (BENCH_LINES / 4), step = i % (BENCH_LINES / 4);
+        u16 x = 0, y = 0;
+        switch(side) {
+            case 0: x = step * (lcd->width - 1) / (BENCH_LINES / 4); break;
+            case 1: x = lcd->width - 1; y = step * (lcd->height - 1) / (BENCH_LINES / 4); break;
+            case 2: x = (lcd->width - 1) - step * (lcd->width - 1) / (BENCH_LINES / 4); y = lcd->height - 1; break;
+            default: y = (lcd->height - 1) - step * (lcd->height - 1) / (BENCH_LINES / 4); break;
+        }
+        st7789_draw_line(lcd, cx, cy, x, y, benchColors[i % BENCH_ROUNDS]);
+    }
+}
+
+static void benchCircles(struct st7789* lcd, const void* arg) {
+    u16 r = (lcd->width < lcd->height ? lcd->width : lcd->height) / 2 - 1;
+    for(u08 i = 0; i < BENCH_ROUNDS; i++) {
+        st7789_draw_circle(lcd, lcd->width / 2, lcd->height / 2, r, 0, benchColors[i]);
+        st7789_draw_circle(lcd, lcd->width / 2, lcd->height / 2, r, 4, benchColors[(i + 1) % BENCH_ROUNDS]);
+    }
+}
+
+static void benchLut8(struct st7789* lcd, const void* arg) {
+    for(u08 i = 0; i < BENCH_ROUNDS; i++) {
+        for(u16 y = 0; y + BENCH_IMAGE <= lcd->height; y += BENCH_IMAGE) {
+            for(u16 x = 0; x + BENCH_IMAGE <= lcd->width; x += BENCH_IMAGE) {
+                st7789_blit_lut8(lcd, x, y, BENCH_IMAGE, BENCH_IMAGE, benchImage, benchPalette);
+            }
+        }
+    }
+}
+
+static void benchScaled(struct st7789* lcd, const void* arg) {
+    for(u08 i = 0; i < BENCH_ROUNDS; i++) {
+        st7789_blit_scaled(lcd, 0, 0, lcd->width, lcd->height, benchSource, BENCH_IMAGE, BENCH_IMAGE);
+    }
+}
+
+static const BenchWorkload_t workloads[] = {
+    {"fill", benchFill, NULL},
+    {"rects", benchRects, NULL},
+    {"dlist_rects", benchDlistRects, NULL},
+    {"text_7x10", benchText, &Font_7x10},
+    {"text_11x18", benchText, &Font_11x18},
+#ifdef ST7789_FONT_16X26
+    {"text_16x26", benchText, &Font_16x26},
+#endif
+    {"text_11x18_x2", benchScaledText, NULL},
+#ifdef ST7789_FONT_AA
+    {"text_aa_22x36", benchText, &FontAA_22x36},
+#endif
+    {"lines", benchLines, NULL},
+    {"circles", benchCircles, NULL},
+    {"blit_lut8", benchLut8, NULL},
+    {"blit_scaled", benchScaled, NULL},
+};
+#define BENCH_WORKLOADS (sizeof(workloads)/sizeof(workloads[0]))
+
+static void benchPrepare() {
+    for(u16 i = 0; i < 256; i++) benchPalette[i] = ST_RGB(i, (255 - i), (i * 7) & 0xFF);
+    for(u16 y = 0; y < BENCH_IMAGE; y++) {
+        for(u16 x = 0; x < BENCH_IMAGE; x++) {
+            benchImage[y * BENCH_IMAGE + x] = (x * 8) ^ (y * 8);
+            benchSource[y * BENCH_IMAGE + x] = ST_RGB(x * 8, y * 8, (x + y) * 4);
+        }
+    }
+}
+
+static void benchRun(struct st7789* lcd, const BenchWorkload_t* workload) {
+    u32 bytes = lcd->tx_bytes, cmds = lcd->tx_cmds, pixels = lcd->tx_pixels;
+    char xip[48] = "";
+    st7789_wait_idle(lcd);
+#ifdef XIP_PROFILE
+    // any write clears the counters, they count for both cores
+    xip_ctrl_hw->ctr_acc = 0;
+    xip_ctrl_hw->ctr_hit = 0;
+#endif
+    uint64_t start = time_us_64();
+    workload->run(lcd, workload->arg);
+    st7789_wait_idle(lcd);
+    u32 us = (u32)(time_us_64() - start);
+#ifdef XIP_PROFILE
+    u32 acc = xip_ctrl_hw->ctr_acc, hit = xip_ctrl_hw->ctr_hit;
+    snprintf(xip, sizeof(xip), " xip_acc=%lu xip_miss=%lu", (unsigned long)acc, (unsigned long)(acc - hit));
+#endif
+    if(us == 0) us = 1;
+    bytes = lcd->tx_bytes - bytes;
+    cmds = lcd->tx_cmds - cmds;
+    pixels = lcd->tx_pixels - pixels;
+    u32 spiKbps = spi_get_baudrate(lcd->cfg.spi) / 8000;
+    u32 kbps = (u32)((uint64_t)bytes * 1000 / us);
+    printf("BENCH %s pixels=%lu cmds=%lu bytes=%lu us=%lu px_s=%lu cmd_s=%lu kbps=%lu spi_kbps=%lu util=%lu%s\n",
+           workload->name, (unsigned long)pixels, (unsigned long)cmds, (unsigned long)bytes, (unsigned long)us,
+           (unsigned long)((uint64_t)pixels * 1000000 / us), (unsigned long)((uint64_t)cmds * 1000000 / us),
+           (unsigned long)kbps, (unsigned long)spiKbps, (unsigned long)(spiKbps ? kbps * 100 / spiKbps : 0), xip);
+}
+
+// One workload per task, so the scheduler and the watchdog feed keep running in between.
+static void benchTask(BaseSize_t step, BaseParam_t lcd) {
+    ClockProfile_t profile = step / BENCH_WORKLOADS;
+    u08 workload = step % BENCH_WORKLOADS;
+    if(profile == CLOCK_PROFILE_COUNT) {
+        setClockProfile(CLOCK_PROFILE_NORMAL);
+        printf("BENCH done\n");
+        gpio_put(BLUE, 1);
+        gpio_put(GREEN, 0);
+        return;
+    }
+    if(workload == 0) {
+        setClockProfile(profile);
+        struct st7789* panel = lcd;
+        printf("BENCH profile=%u clk_sys_khz=%lu clk_peri_khz=%lu spi_hz=%lu format=%s ram_funcs=%u\n", profile,
+               (unsigned long)(clock_get_hz(clk_sys) / 1000), (unsigned long)(clock_get_hz(clk_peri) / 1000),
+               (unsigned long)spi_get_baudrate(panel->cfg.spi), panel->cfg.pixel_format == ST7789_FORMAT_RGB444 ? "444" : "565",
+               BENCH_RAM_FUNCS);
+    }
+    benchRun(lcd, &workloads[workload]);
+    schedTask(benchTask, step + 1, lcd);
+}
+
+void benchmarkStart(struct st7789* lcd) {
+    benchPrepare();
+    gpio_put(BLUE, 0);
+    display_enable(lcd, true);
+    schedTask(benchTask, 0, lcd);
+}
@@ -0,0 +1,19 @@
+#ifndef BENCHMARK_H_
+#define BENCHMARK_H_
+
+struct st7789;
+
+// Display benchmark, selected by holding BUTTON during boot. Runs a fixed set of
+// workloads at every clock profile and prints one line per workload on stdio:
+//
+// BENCH profile=<n> clk_sys_khz=<n> clk_peri_khz=<n> spi_hz=<n> format=<565|444> ram_funcs=<0|1>
+// BENCH <workload> pixels=<n> cmds=<n> bytes=<n> us=<n> px_s=<n> cmd_s=<n> kbps=<n> spi_kbps=<n> util=<percent> [xip_acc=<n> xip_miss=<n>]
+// BENCH done
+//
+// kbps is the achieved byte rate, spi_kbps what the SPI clock allows. ram_funcs
+// tells a RAM_HOT_PATHS build apart, the xip fields are only there with
+// XIP_PROFILE: flash cache accesses and misses of both cores during the workload.
+// Every line is a single printf, so it is never split by log frames from the other core.
+void benchmarkStart(struct st7789* lcd); // once the panel is ready, returns immediately
+
+#endif /*BENCHMARK_H_*/
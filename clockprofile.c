@@ -0,0 +1,130 @@
+#include "clockprofile.h"
+
+#include <pico/stdlib.h>
+#include <pico/multicore.h>
+#include <pico/sync.h>
+#include <hardware/clocks.h>
+#include <hardware/structs/systick.h>
+#include <hardware/structs/watchdog.h>
+#include <hardware/regs/m0plus.h>
+
+#include "femtox/TaskMngr.h"
+#include "logring.h"
+
+// clk_sys frequencies, all exactly attainable by the system PLL from the 12 MHz crystal.
+// clk_peri is attached straight to the system PLL (no divider available), so it
+// follows clk_sys and every SPI divider has to be re-derived after a switch.
+// clk_ref, and with it the 1 MHz timer behind time_us_64(), and clk_usb stay untouched.
+static const u32 profileKhz[CLOCK_PROFILE_COUNT] = {
+    [CLOCK_PROFILE_LOW]    = 48 * KHZ,
+    [CLOCK_PROFILE_NORMAL] = 120 * KHZ,
+    [CLOCK_PROFILE_BOOST]  = 133 * KHZ,
+};
+
+static ClockProfileHook hooks[CLOCK_PROFILE_MAX_HOOKS];
+static u08 hooksCount = 0;
+static volatile ClockProfile_t currentProfile = CLOCK_PROFILE_COUNT;
+static volatile bool_t lockoutReady[2] = {FALSE, FALSE};
+static mutex_t clockMutex;
+static u32 switchTick;
+static uint64_t switchUs;
+
+// Every Time_t delay assumes TICK_PER_SECOND femtox ticks per second at any
+// profile. A tick from timer alarms or the watchdog tick runs on clk_ref and does
+// not care. A SysTick on the processor clock does: its reload is re-derived for the
+// new clk_sys on the switching core, 48000 cycles per 1 ms tick at 48 MHz. The
+// other core's SysTick is out of reach, so a switch also compares getTick() with
+// time_us_64() over at least a second since the last comparison and is refused
+// when they disagree by more than 1/16. Ticks femtox delivered late under load
+// count as a disagreement too, the next switch compares a fresh interval.
+static bool_t tickSourceOk() {
+    if(!(watchdog_hw->tick & WATCHDOG_TICK_ENABLE_BITS)) {
+        LOG0(LOG_TICK_SOURCE);
+        return FALSE;
+    }
+    u32 tick = getTick();
+    uint64_t us = time_us_64();
+    uint64_t elapsedUs = us - switchUs;
+    uint64_t tickUs = (uint64_t)(tick - switchTick) * 1000000 / TICK_PER_SECOND;
+    if(switchUs != 0 && elapsedUs < 1000000) return TRUE; // too short to tell, keep the reference
+    bool_t first = switchUs == 0;
+    switchTick = tick;
+    switchUs = us;
+    if(first) return TRUE;
+    if(tickUs > elapsedUs - (elapsedUs >> 4) && tickUs < elapsedUs + (elapsedUs >> 4)) return TRUE;
+    LOG2(LOG_TICK_DRIFT, (u32)(tickUs / 1000), (u32)(elapsedUs / 1000));
+    return FALSE;
+}
+
+static void retuneSysTick(u32 khz) {
+    const u32 tickIrq = M0PLUS_SYST_CSR_ENABLE_BITS | M0PLUS_SYST_CSR_TICKINT_BITS;
+    u32 csr = systick_hw->csr;
+    if((csr & tickIrq) != tickIrq || !(csr & M0PLUS_SYST_CSR_CLKSOURCE_BITS)) return;
+    systick_hw->rvr = khz * KHZ / TICK_PER_SECOND - 1;
+    systick_hw->cvr = 0;
+}
+
+static void applyClocks(ClockProfile_t profile) {
+    u32 khz = profileKhz[profile];
+    set_sys_clock_khz(khz, true);
+    retuneSysTick(khz);
+    clock_configure(
+        clk_peri,
+        CLOCKS_CLK_PERI_CTRL_AUXSRC_RESET,                // No glitchless mux
+        CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_SYS, // System PLL on AUX mux
+        khz * KHZ,                                        // Input frequency
+        khz * KHZ                                         // Output (must be same as no divider)
+    );
+    currentProfile = profile;
+}
+
+static void runHooks(ClockProfileEvent_t event, ClockProfile_t profile) {
+    for(u08 i = 0; i < hooksCount; i++) {
+        hooks[i](event, profile, profileKhz[profile]);
+    }
+}
+
+void initClockProfile(ClockProfile_t profile) {
+    mutex_init(&clockMutex);
+    applyClocks(profile);
+}
+
+void initClockProfileCore() {
+    multicore_lockout_victim_init();
+    lockoutReady[get_core_num()] = TRUE;
+}
+
+bool_t addClockProfileHook(ClockProfileHook hook) {
+    if(hooksCount >= CLOCK_PROFILE_MAX_HOOKS) return FALSE;
+    hooks[hooksCount++] = hook;
+    return TRUE;
+}
+
+bool_t setClockProfile(ClockProfile_t profile) {
+    if(profile >= CLOCK_PROFILE_COUNT) return FALSE;
+    mutex_enter_blocking(&clockMutex);
+    if(profile == currentProfile) {
+        mutex_exit(&clockMutex);
+        return TRUE;
+    }
+    if(!tickSourceOk()) {
+        mutex_exit(&clockMutex);
+        return FALSE;
+    }
+    bool_t lockout = lockoutReady[0] && lockoutReady[1];
+    if(lockout) multicore_lockout_start_blocking();
+    runHooks(CLOCK_PROFILE_PREPARE, profile);
+    applyClocks(profile);
+    runHooks(CLOCK_PROFILE_APPLIED, profile);
+    if(lockout) multicore_lockout_end_blocking();
+    mutex_exit(&clockMutex);
+    return TRUE;
+}
+
+ClockProfile_t getClockProfile() {
+    return currentProfile;
+}
+
+u32 getClockProfileKhz(ClockProfile_t profile) {
+    return profile < CLOCK_PROFILE_COUNT ? profileKhz[profile] : 0;
+}
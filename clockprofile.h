@@ -0,0 +1,30 @@
+#ifndef CLOCKPROFILE_H_
+#define CLOCKPROFILE_H_
+
+#include "femtox/FemtoxTypes.h"
+
+typedef enum {
+    CLOCK_PROFILE_LOW,    // display disabled, only housekeeping tasks run
+    CLOCK_PROFILE_NORMAL, // display on
+    CLOCK_PROFILE_BOOST,  // full screen redraw bursts
+    CLOCK_PROFILE_COUNT
+} ClockProfile_t;
+
+typedef enum {
+    CLOCK_PROFILE_PREPARE, // clocks still old, let peripherals finish their transfers
+    CLOCK_PROFILE_APPLIED  // clocks switched, re-derive dividers from clk_peri_khz
+} ClockProfileEvent_t;
+
+// Hooks run on the switching core while the other core is locked out.
+typedef void (*ClockProfileHook)(ClockProfileEvent_t event, ClockProfile_t profile, u32 clk_peri_khz);
+
+#define CLOCK_PROFILE_MAX_HOOKS 4
+
+void initClockProfile(ClockProfile_t profile); // boot time, before the second core starts
+void initClockProfileCore();                   // once on each core after multicore_launch_core1
+bool_t addClockProfileHook(ClockProfileHook hook);
+bool_t setClockProfile(ClockProfile_t profile); // FALSE and logged when the femtox tick drifted
+ClockProfile_t getClockProfile();
+u32 getClockProfileKhz(ClockProfile_t profile);
+
+#endif /*CLOCKPROFILE_H_*/
@@ -1,10 +1,15 @@
 #include "gpio.h"
+#include "sched.h"
 #include "femtox/TaskMngr.h"
 #include "femtox/PlatformSpecific.h"
 
 #include <hardware/gpio.h>
+#include <hardware/timer.h>
 
 static const Time_t checkButtonDelay = TICK_PER_SECOND>>4;
+static volatile uint64_t buttonPressUs = 0;
+static volatile uint64_t buttonReleaseUs = 0;
+static volatile uint64_t buttonCheckUs = 0;
 
 static void checkBtnPressed(BaseSize_t count, BaseParam_t arg_p);
 static void checkBtnReleased(BaseSize_t count, BaseParam_t arg_p);
@@ -13,44 +18,73 @@ const void* ClickEvent = (void*)buttonPressedHandler;
 const void* PressedEvent = (void*)checkBtnPressed;
 const void* ReleasedEvent = (void*)checkBtnReleased;
 
+static void armButton() {
+    gpio_set_irq_enabled(BUTTON, GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, true);
+}
+
 static void checkBtnPressed(BaseSize_t count, BaseParam_t arg_p) {
     bool_t state = gpio_get(BUTTON);
+    if(count == 0) buttonCheckUs = time_us_64();
     if(count == MIN_COUNT_CHECK_BTN) {
-        emitSignal(PressedEvent, 0, NULL);
+        schedEmitPrio(PressedEvent, 0, NULL, SCHED_PRIO_INPUT);
     }
     if(!state) {
-        SetTimerTask(checkBtnPressed, count+1, (BaseParam_t)0, checkButtonDelay);
+        schedTimerPrio(checkBtnPressed, count+1, (BaseParam_t)0, checkButtonDelay, SCHED_PRIO_INPUT);
         return;
     } else if(count >= MIN_COUNT_CHECK_BTN) {
-        emitSignal(ClickEvent, count, (BaseParam_t)(count*(checkButtonDelay)));
+        uint64_t pressUs = buttonPressUs;
+        buttonReleaseUs = time_us_64();
+        SCHED_EMIT(ClickEvent, SCHED_PRIO_INPUT, ButtonEvent_t, pressUs, (uint32_t)(buttonReleaseUs - pressUs), count);
+        // the rising edge came while the IRQ was off, debounce the release from here
+        schedTimerPrio(checkBtnReleased, 0, NULL, checkButtonDelay, SCHED_PRIO_INPUT);
+        return;
     }
-    gpio_set_irq_enabled(BUTTON, GPIO_IRQ_EDGE_FALL, true);
+    armButton();
 }
 
 static void checkBtnReleased(BaseSize_t count, BaseParam_t arg_p) {
     bool state = gpio_get(BUTTON);
-    if(state && count < MIN_COUNT_CHECK_BTN) {
-        SetTimerTask(checkBtnReleased, count+1, arg_p, checkButtonDelay);
+    if(!state) {
+        // pressed again before the release settled
+        buttonPressUs = time_us_64();
+        schedTaskPrio(checkBtnPressed, 0, NULL, SCHED_PRIO_INPUT);
+        return;
+    } else if(count < MIN_COUNT_CHECK_BTN) {
+        schedTimerPrio(checkBtnReleased, count+1, arg_p, checkButtonDelay, SCHED_PRIO_INPUT);
         return;
-    } else if(state) {
-        emitSignal(ReleasedEvent, 0, NULL);
     }
-    gpio_set_irq_enabled(BUTTON, GPIO_IRQ_EDGE_RISE, true);
+    schedEmitPrio(ReleasedEvent, 0, NULL, SCHED_PRIO_INPUT);
+    armButton();
 }
 
 static void buttonPressedHandler(uint gpio, uint32_t event) {
+    uint64_t now = time_us_64();
+    if(event & GPIO_IRQ_EDGE_FALL) buttonPressUs = now;
+    if(event & GPIO_IRQ_EDGE_RISE) buttonReleaseUs = now;
     gpio_set_irq_enabled(
         BUTTON, 
         GPIO_IRQ_EDGE_RISE | GPIO_IRQ_EDGE_FALL, 
         false);
-    if(event && GPIO_IRQ_EDGE_FALL) {
-        SetTask(checkBtnPressed, 0, NULL); //check button still pressed
+    if(event & GPIO_IRQ_EDGE_FALL) {
+        schedTaskPrio(checkBtnPressed, 0, NULL, SCHED_PRIO_INPUT); //check button still pressed
     }
-    if(event && GPIO_IRQ_EDGE_RISE) {
-        SetTask(checkBtnReleased, 0, NULL); //check button still pressed
+    if(event & GPIO_IRQ_EDGE_RISE) {
+        schedTaskPrio(checkBtnReleased, 0, NULL, SCHED_PRIO_INPUT); //check button still pressed
     }
 }
 
+uint64_t getButtonPressTime() {
+    return buttonPressUs;
+}
+
+uint64_t getButtonReleaseTime() {
+    return buttonReleaseUs;
+}
+
+uint64_t getButtonCheckTime() {
+    return buttonCheckUs;
+}
+
 void initInput() {
     gpio_init(BUTTON);
     gpio_set_dir(BUTTON, GPIO_IN);
@@ -1,6 +1,8 @@
 #ifndef GPIO_H_
 #define GPIO_H_
 
+#include <stdint.h>
+
 #define BLUE 20
 #define GREEN 19
 #define RED 18
@@ -11,6 +13,16 @@
 
 void initLED();
 void initInput();
+uint64_t getButtonPressTime();   // time_us_64() of the last falling edge, captured in the IRQ
+uint64_t getButtonReleaseTime(); // time_us_64() when the last release was seen
+uint64_t getButtonCheckTime();   // time_us_64() when the first debounce check of the last press ran
+
+// ClickEvent payload, handlers get sizeof(ButtonEvent_t) as n and the event as p.
+typedef struct {
+    uint64_t pressUs; // time_us_64() of the falling edge that started the click
+    uint32_t heldUs;  // until the release was seen by the debounce check
+    uint16_t checks;  // debounce checks while held
+} ButtonEvent_t;
 
 extern const void* ClickEvent;
 extern const void* PressedEvent;
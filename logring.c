@@ -0,0 +1,74 @@
+#include "logring.h"
+
+#include <stdio.h>
+#include <pico/stdlib.h>
+#include <hardware/sync.h>
+#include <hardware/timer.h>
+
+// One single-producer ring per core: tasks and IRQs of a core only touch their own
+// ring, so the hot path needs no spin lock, only a short IRQ-off window.
+typedef struct {
+    LogRecord_t records[LOG_RING_SIZE];
+    volatile u32 head;    // written by the producing core
+    volatile u32 tail;    // written by the consumer
+    volatile u32 dropped; // written by the producing core
+    u32 reported;         // dropped records already reported by the consumer
+} LogRing_t;
+
+static LogRing_t logRings[2];
+
+void initLogRing() {
+    for(u08 i = 0; i < 2; i++) {
+        logRings[i].head = logRings[i].tail = 0;
+        logRings[i].dropped = logRings[i].reported = 0;
+    }
+}
+
+void logRecord(LogFormat_t format, u08 argc, u32 arg0, u32 arg1, u32 arg2) {
+    u08 core = get_core_num();
+    LogRing_t* ring = &logRings[core];
+    u32 irq = save_and_disable_interrupts();
+    u32 head = ring->head;
+    if(head - ring->tail >= LOG_RING_SIZE) {
+        ring->dropped++;
+        restore_interrupts(irq);
+        return;
+    }
+    LogRecord_t* rec = &ring->records[head & (LOG_RING_SIZE - 1)];
+    rec->timestamp = timer_hw->timerawl;
+    rec->format = format;
+    rec->core = core;
+    rec->argc = argc;
+    rec->arg[0] = arg0;
+    rec->arg[1] = arg1;
+    rec->arg[2] = arg2;
+    __dmb();
+    ring->head = head + 1;
+    restore_interrupts(irq);
+}
+
+static void sendRecord(const LogRecord_t* rec) {
+    const u08* bytes = (const u08*)rec;
+    putchar_raw(LOG_FRAME_SYNC0);
+    putchar_raw(LOG_FRAME_SYNC1);
+    for(u08 i = 0; i < sizeof(LogRecord_t); i++) {
+        putchar_raw(bytes[i]);
+    }
+}
+
+void logDrain() {
+    for(u08 core = 0; core < 2; core++) {
+        LogRing_t* ring = &logRings[core];
+        u32 dropped = ring->dropped;
+        if(dropped != ring->reported) {
+            LogRecord_t rec = {timer_hw->timerawl, LOG_DROPPED, core, 1, {dropped - ring->reported, 0, 0}};
+            sendRecord(&rec);
+            ring->reported = dropped;
+        }
+        while(ring->tail != ring->head) {
+            __dmb();
+            sendRecord(&ring->records[ring->tail & (LOG_RING_SIZE - 1)]);
+            ring->tail++;
+        }
+    }
+}
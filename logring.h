@@ -0,0 +1,60 @@
+#ifndef LOGRING_H_
+#define LOGRING_H_
+
+#include "femtox/FemtoxTypes.h"
+
+#define LOG_RING_SIZE 64 // records per core, must be a power of two
+
+#define LOG_FRAME_SYNC0 0x55
+#define LOG_FRAME_SYNC1 0xAA
+
+// Format table, the host decoder (tools/logdecode.py) parses it from this header.
+// Every format takes at most three arguments, %u or %x.
+#define LOG_FORMATS(X) \
+    X(LOG_DROPPED,        "log ring overflow, %u records dropped") \
+    X(LOG_TEST_TIMER,     "test timer %u") \
+    X(LOG_BTN_CLICK,      "button clicked, held %u ms") \
+    X(LOG_BTN_PRESSED,    "button pressed") \
+    X(LOG_BTN_RELEASED,   "button released") \
+    X(LOG_INVERT_COLORS,  "invert colors in screen") \
+    X(LOG_STAND_WITH_UA,  "stand with Ukraine task at %u,%u") \
+    X(LOG_BLIT_REF,       "blit kernel %u reference: %u cycles/px x100") \
+    X(LOG_BLIT_INTERP,    "blit kernel %u interp: %u cycles/px x100") \
+    X(LOG_BLIT_MISMATCH,  "blit kernel %u: %u pixels differ from reference") \
+    X(LOG_SCHED_OVERFLOW, "sched pool %u full, %u allocations refused so far") \
+    X(LOG_DEADLINE_MISS,  "deadline miss #%u of task 0x%08x, %u ticks late") \
+    X(LOG_WATCHDOG_WITHHELD, "critical deadline missed, watchdog not fed") \
+    X(LOG_SCHED_LATENCY,  "priority %u task ran %u us after the button press") \
+    X(LOG_CLOCK_FACE_BYTES, "panel %u bytes/s, largest clock face update %u bytes") \
+    X(LOG_XIP_CACHE,      "xip cache %u accesses/s, %u misses/s") \
+    X(LOG_PARTIAL_UNAVAILABLE, "no partial band for the always on clock, idle mode scans the whole panel") \
+    X(LOG_TICK_SOURCE,    "watchdog tick off, no 1 MHz reference, clock switch refused") \
+    X(LOG_TICK_DRIFT,     "femtox counted %u ms in %u ms since the last switch, clock switch refused") \
+    X(LOG_DISPLAY_STARTUP, "panel ready %u us after st7789_init, %u ms after boot")
+
+#define LOG_FORMAT_ID(id, fmt) id,
+typedef enum {
+    LOG_FORMATS(LOG_FORMAT_ID)
+    LOG_FORMAT_COUNT
+} LogFormat_t;
+#undef LOG_FORMAT_ID
+
+// Wire layout of one record, sent after the two sync bytes, little endian.
+typedef struct {
+    u32 timestamp; // time_us_32() when the record was written
+    u16 format;
+    u08 core;
+    u08 argc;
+    u32 arg[3];
+} LogRecord_t;
+
+void initLogRing();
+void logRecord(LogFormat_t format, u08 argc, u32 arg0, u32 arg1, u32 arg2);
+void logDrain(); // call from the idle task of core 0 only, it is the single consumer
+
+#define LOG0(format)             logRecord(format, 0, 0, 0, 0)
+#define LOG1(format, a0)         logRecord(format, 1, (u32)(a0), 0, 0)
+#define LOG2(format, a0, a1)     logRecord(format, 2, (u32)(a0), (u32)(a1), 0)
+#define LOG3(format, a0, a1, a2) logRecord(format, 3, (u32)(a0), (u32)(a1), (u32)(a2))
+
+#endif /*LOGRING_H_*/
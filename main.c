@@ -8,15 +8,30 @@
 #include <hardware/pll.h>
 #include <hardware/structs/pll.h>
 #include <hardware/structs/clocks.h>
+#ifdef XIP_PROFILE
+#include <hardware/structs/xip_ctrl.h>
+#endif
 
 #include "gpio.h"
+#include "stopwatch.h"
+#include "logring.h"
+#include "clockprofile.h"
+#include "widgets.h"
+#ifdef ANALOG_CLOCK
+#include "analogclock.h"
+#endif
+#include "sched.h"
+#include "benchmark.h"
 #include "st7789/st7789.h"
+#ifdef BLIT_BENCH
+#include "st7789/blit.h"
+#endif
+#ifdef DISPLAY_MIRROR
+#include "st7789/mirror.h"
+#endif
 #include "femtox/TaskMngr.h"
 #include "femtox/PlatformSpecific.h"
 #include "femtox/String.h"
-#include "femtox/logging.h"
-
-#define PLL_SYS_KHZ (120 * KHZ)
 
 #define DISPLAY_ON 2
 #define DATA_DIR 1
@@ -25,261 +40,580 @@
 #define SPI_TX  7
 #define SPI_SCK 6
 
+#ifdef DUAL_DISPLAY
+// second panel on spi1, pins exposed on the Tiny 2040 castellations
+#define DISPLAY2_ON 3
+#define DISPLAY2_DC 28
+#define DISPLAY2_RST 29
+#define SPI1_TX  27
+#define SPI1_SCK 26
+#endif
+
 #define SCREEN_WIDTH 240
 #define SCREEN_HEIGHT 240
 
 void test1(BaseSize_t n, BaseParam_t arg_p) {
-    printf("%d\n",n);
-    SetTimerTask((TaskMng)test1, n, arg_p, TICK_PER_SECOND*n);
+    LOG1(LOG_TEST_TIMER, n);
+    schedTimer((TaskMng)test1, n, arg_p, TICK_PER_SECOND*n);
+}
+
+#ifdef BLIT_BENCH
+void blitBenchTask(BaseSize_t n, BaseParam_t arg_p) {
+    struct blit_bench bench;
+    blit_benchmark(&bench);
+    for(u08 k = 0; k < BLIT_KERNEL_COUNT; k++) {
+        LOG2(LOG_BLIT_REF, k, bench.ref_cycles[k]);
+        LOG2(LOG_BLIT_INTERP, k, bench.interp_cycles[k]);
+        if(bench.mismatches[k]) LOG2(LOG_BLIT_MISMATCH, k, bench.mismatches[k]);
+    }
+}
+#endif
+
+static void schedOverflow(BaseSize_t pool, BaseParam_t arg_p) {
+    SchedPoolStats_t stats;
+    schedPoolStats(pool, &stats);
+    LOG2(LOG_SCHED_OVERFLOW, pool, stats.overflows);
+}
+
+static void deadlineMissed(BaseSize_t late, BaseParam_t task) {
+    SchedDeadlineStats_t stats = {0};
+    schedDeadlineStats((TaskMng)task, &stats);
+    LOG3(LOG_DEADLINE_MISS, stats.misses, (uintptr_t)task, late);
+}
+
+#define WATCHDOG_FEED_PERIOD (TICK_PER_SECOND>>1)
+
+// a stuck or overloaded system stops feeding and gets reset
+static void feedWatchDog() {
+    if(schedCriticalOk()) resetWatchDog();
+    else LOG0(LOG_WATCHDOG_WITHHELD);
+}
+
+#ifdef LATENCY_BENCH
+#define LATENCY_LOAD_TASKS 16
+#define LATENCY_LOAD_US 2500 // one 240x40 RGB565 fill at 62.5 MHz SPI
+#define LATENCY_HOLD_MS 300  // past the debounce checks, short of a long press
+
+static volatile uint64_t probePostedUs;
+
+// stands in for rendering without touching the panel from both cores
+static void renderLoad(BaseSize_t n, BaseParam_t arg_p) {
+    busy_wait_us_32(LATENCY_LOAD_US);
+}
+
+static void latencyProbe(BaseSize_t n, BaseParam_t arg_p) {
+    LOG2(LOG_SCHED_LATENCY, SCHED_PRIO_NORMAL, (u32)(time_us_64() - probePostedUs));
+}
+
+// Forces the button input low behind the pad, the edge then takes the path of a
+// real press: GPIO IRQ, buttonPressedHandler, first debounce check at input priority.
+static int64_t latencyPress(alarm_id_t id, void* arg_p) {
+    probePostedUs = time_us_64();
+    gpio_set_inover(BUTTON, GPIO_OVERRIDE_LOW);
+    schedTask(latencyProbe, 0, NULL);
+    return 0;
+}
+
+static void latencyRelease(BaseSize_t n, BaseParam_t arg_p) {
+    gpio_set_inover(BUTTON, GPIO_OVERRIDE_NORMAL);
+    LOG2(LOG_SCHED_LATENCY, SCHED_PRIO_INPUT, (u32)(getButtonCheckTime() - getButtonPressTime()));
+}
+
+// Saturates the render level, presses the button while both cores are busy and
+// posts a normal priority probe at the same moment. Each round ends in a short
+// click the application handles like a real one.
+void latencyBenchTask(BaseSize_t round, BaseParam_t arg_p) {
+    for(u08 i = 0; i < LATENCY_LOAD_TASKS; i++) schedTask(renderLoad, i, NULL);
+    add_alarm_in_us(100, latencyPress, NULL, true);
+    schedTimer(latencyRelease, 0, NULL, TICK_PER_SECOND * LATENCY_HOLD_MS / 1000);
+    if(round < 8) schedTimer(latencyBenchTask, round + 1, NULL, TICK_PER_SECOND);
 }
+#endif
 
-void measure_freqs(void) {
-    uint f_pll_sys = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_PLL_SYS_CLKSRC_PRIMARY);
-    uint f_pll_usb = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_PLL_USB_CLKSRC_PRIMARY);
-    uint f_rosc = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_ROSC_CLKSRC);
-    uint f_clk_sys = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_SYS);
-    uint f_clk_peri = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_PERI);
-    uint f_clk_usb = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_USB);
-    uint f_clk_adc = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_ADC);
-    uint f_clk_rtc = frequency_count_khz(CLOCKS_FC0_SRC_VALUE_CLK_RTC);
-    SetTimerTask((TaskMng)measure_freqs, 0, NULL, TICK_PER_SECOND>>1);
+#ifdef XIP_PROFILE
+#define XIP_PROFILE_SECONDS 10 // back to back fetches wrap ctr_acc in about 30 s
+
+// Flash cache traffic of both cores in normal use, the counters restart on every report.
+static void xipProfile() {
+    u32 acc = xip_ctrl_hw->ctr_acc, hit = xip_ctrl_hw->ctr_hit;
+    xip_ctrl_hw->ctr_acc = 0;
+    xip_ctrl_hw->ctr_hit = 0;
+    LOG2(LOG_XIP_CACHE, acc / XIP_PROFILE_SECONDS, (acc - hit) / XIP_PROFILE_SECONDS);
 }
+#endif
 
 void initDisplay(struct st7789_config* display) {
     display->spi = spi0;
-    display->clk_perif_khz = PLL_SYS_KHZ;
+    display->clk_perif_khz = getClockProfileKhz(getClockProfile());
     display->gpio_din = SPI_TX;
     display->gpio_clk = SPI_SCK;
     display->gpio_bl = DISPLAY_ON;
     display->gpio_dc = DATA_DIR;
     display->gpio_rst = DISPLAY_RST;
+#ifdef DISPLAY_RGB444
+    display->pixel_format = ST7789_FORMAT_RGB444;
+#else
+    display->pixel_format = ST7789_FORMAT_RGB565;
+#endif
 }
 
-void displayTestTask(BaseSize_t count, BaseParam_t time) {
-    Time_t t = (Time_t)time;
-    switch(count) {
-        case 0:
-            gpio_put(BLUE, 1);
-            gpio_put(GREEN, 0);
-            st7789_fill(ST_COLOR_GREEN);
-            count++;
-            break;
-        case 1: 
-            gpio_put(GREEN, 1);
-            gpio_put(RED, 0);
-            st7789_fill(ST_COLOR_RED);
-            count++;
-            break;
-        case 2:
-            gpio_put(RED, 1);
-            gpio_put(BLUE, 0);
-            st7789_fill(ST_COLOR_BLUE);
-            count = 0;
-            break;
+static struct st7789 screen;
+#ifdef DUAL_DISPLAY
+static struct st7789 screen2;
+#endif
+
+static void displayClockHook(ClockProfileEvent_t event, ClockProfile_t profile, u32 clk_peri_khz) {
+    if(event == CLOCK_PROFILE_PREPARE) {
+        st7789_wait_idle(&screen);
+#ifdef DUAL_DISPLAY
+        st7789_wait_idle(&screen2);
+#endif
+        return;
     }
-    SetTimerTask(displayTestTask, count, time, t);
+    st7789_set_clk_perif(&screen, clk_peri_khz);
+#ifdef DUAL_DISPLAY
+    st7789_set_clk_perif(&screen2, clk_peri_khz);
+#endif
 }
 
 static u08 displayOnTimeout = 12;
-static u16 currentBackground = ST_COLOR_BLACK;
-static u16 currentColor[2] = {ST_COLOR_WHITE, ST_COLOR_RED};
-#define BACKGROUD_CHANGED (void*)(&currentBackground)
+static SchedTimer_t displayOffTimer = SCHED_NONE;
+static SchedTimer_t clockCycle = SCHED_NONE;
+static SchedTimer_t stopwatchCycle = SCHED_NONE;
+static WidgetLayer_t ui;
+static Widget_t dateLabel, timeLabel, secondsLabel;
+static Widget_t ukraineLabel, flagTop, flagBottom;
+static Widget_t swCaption, swSeconds, swHundredths, swLap;
+#ifdef ANALOG_CLOCK
+static ClockFace_t face; // between the digital time and the flag, under the stopwatch
+#endif
+
+static void initUi() {
+    widgetLayerInit(&ui, &screen);
+    themeSet(&ui, THEME_BACKGROUND, ST_COLOR_BLACK);
+    themeSet(&ui, THEME_FOREGROUND, ST_COLOR_WHITE);
+    themeSet(&ui, THEME_ACCENT, ST_COLOR_RED);
+    widgetLabel(&dateLabel, 10, 20, &Font_7x10, 2, THEME_COLOR(THEME_FOREGROUND), THEME_COLOR(THEME_BACKGROUND));
+#ifdef ST7789_FONT_AA
+    // the same 22x36 cells as Font_11x18 twice, with smooth edges
+    widgetLabel(&timeLabel, 35, 50, &FontAA_22x36, 1, THEME_COLOR(THEME_FOREGROUND), THEME_COLOR(THEME_BACKGROUND));
+    widgetLabel(&secondsLabel, 35+22*6, 50, &FontAA_22x36, 1, THEME_COLOR(THEME_ACCENT), THEME_COLOR(THEME_BACKGROUND));
+#else
+    widgetLabel(&timeLabel, 35, 50, &Font_11x18, 2, THEME_COLOR(THEME_FOREGROUND), THEME_COLOR(THEME_BACKGROUND));
+    widgetLabel(&secondsLabel, 35+22*6, 50, &Font_11x18, 2, THEME_COLOR(THEME_ACCENT), THEME_COLOR(THEME_BACKGROUND));
+#endif
+    widgetLabel(&swCaption, 10, SCREEN_HEIGHT/2-10, &Font_7x10, 2, THEME_COLOR(THEME_FOREGROUND), THEME_COLOR(THEME_BACKGROUND));
+    widgetNumber(&swSeconds, 10+4*14, SCREEN_HEIGHT/2-10, 6, &Font_7x10, 2, THEME_COLOR(THEME_FOREGROUND), THEME_COLOR(THEME_BACKGROUND));
+    widgetLabel(&swHundredths, SCREEN_WIDTH-2*14-10, SCREEN_HEIGHT/2-10, &Font_7x10, 2, THEME_COLOR(THEME_ACCENT), THEME_COLOR(THEME_BACKGROUND));
+    widgetLabel(&swLap, 10, SCREEN_HEIGHT/2+20, &Font_11x18, 1, THEME_COLOR(THEME_FOREGROUND), THEME_COLOR(THEME_BACKGROUND));
+    widgetSetText(&ui, &swCaption, "sec:");
+    Widget_t* widgets[] = {&dateLabel, &timeLabel, &secondsLabel, &swCaption, &swSeconds, &swHundredths, &swLap};
+    for(u08 i = 0; i < sizeof(widgets)/sizeof(widgets[0]); i++) {
+        widgetAdd(&ui, widgets[i]);
+    }
+    // stopwatch stays hidden until started
+    swCaption.visible = swSeconds.visible = swHundredths.visible = swLap.visible = FALSE;
+#ifdef ANALOG_CLOCK
+    clockFaceInit(&face, &ui, SCREEN_WIDTH/2, 148, 48);
+#endif
+}
+
+#ifdef ANALOG_CLOCK
+static u32 lastSeconds;
+void showTimeDate();
+// Emitted by showTimeDate with the new getAllSeconds() value as a u32 payload.
+const void* SecondsChangedEvent = (void*)showTimeDate;
+#endif
 
 void showTimeDate() {
-    const u08 date_startX = 10;
-    const u08 date_startY = 20;
-    const u08 time_startX = 35;
-    const u08 time_startY = 50;
-	static Date_t prev = {0};
-	static u16 prevBackGround = 0;
-	static u16 prevFontColor = 0;
-	Date_t current = getDateFromSeconds(getAllSeconds(), TRUE);
+	u32 seconds = getAllSeconds();
+	Date_t current = getDateFromSeconds(seconds, TRUE);
 	char dateStr[19] = {0};
 	dateToString(dateStr, &current);
 	strSplit(' ', dateStr);
-	if(prevBackGround != currentBackground) {
-		st7789_fill(currentBackground);
-        execCallBack(BACKGROUD_CHANGED);
-	}
-	if(current.year != prev.year || current.mon != prev.mon || current.day != prev.day || prevFontColor != currentColor[0]) {
-		prev.year = current.year;
-		prev.mon = current.mon;
-		prev.day = current.day;
-		st7789_write_string(date_startX,date_startY, dateStr, Font_16x26, currentColor[0], currentBackground);
+	char *timeStr = dateStr + strSize(dateStr) + 1;
+	widgetSetText(&ui, &secondsLabel, timeStr + 6);
+	timeStr[6] = END_STRING;
+	widgetSetText(&ui, &dateLabel, dateStr);
+	widgetSetText(&ui, &timeLabel, timeStr);
+	widgetsRender(&ui);
+#ifdef ANALOG_CLOCK
+	if(seconds != lastSeconds) {
+		lastSeconds = seconds;
+		SCHED_EMIT(SecondsChangedEvent, SCHED_PRIO_TIMING, u32, seconds);
 	}
-	if(current.hour != prev.hour || current.min != prev.min || prevFontColor != currentColor[0]) {
-		prev.hour = current.hour;
-		prev.min = current.min;
-		char *timeStr = dateStr + strSize(dateStr) + 1;
-		timeStr[6] = END_STRING;
-		st7789_write_string(time_startX,time_startY, timeStr, Font_16x26, currentColor[0], currentBackground);
-	}
-	st7789_write_string(time_startX+16*6,time_startY, dateStr+15, Font_16x26, currentColor[1], currentBackground);
-	prevBackGround = currentBackground;
-	prevFontColor = currentColor[0];
+#endif
+}
+
+#ifdef ANALOG_CLOCK
+static u32 lastTxBytes;
+
+static void showFace(BaseSize_t size, const u32* seconds) {
+    Date_t now = getDateFromSeconds(*seconds, TRUE);
+    clockFaceUpdate(&face, now.hour * 3600 + now.min * 60 + now.sec);
+    if(now.sec == 0) {
+        // all drawing on the panel, not only the face
+        LOG2(LOG_CLOCK_FACE_BYTES, (screen.tx_bytes - lastTxBytes) / 60, face.maxBytes);
+        lastTxBytes = screen.tx_bytes;
+    }
 }
+#endif
+
+typedef struct {
+    u16 x, y;
+    u16 logoX, logoY;
+} UkraineLayout_t;
 
-void standWithUkraine(u32 xy, BaseParam_t logoXY) {
-    u16 x = (u16)xy & 0xFFFF;
-    u16 y = (u16)(xy >> 16);
-    u32 logo = (u32)(logoXY);
-    u16 logoX = (u16)logo & 0xFFFF;
-    u16 logoY = (u16)(logo>>16);
-    writeLogStr("Stand with Ukraine task");
-	st7789_write_string(x, y, "WITH UKRAINE", Font_11x18, currentColor[0], currentBackground);
-	st7789_draw_filled_rectangle(logoX, logoY, 60, 20, ST_COLOR_BLUE);
-	st7789_draw_filled_rectangle(logoX, logoY+20, 60, 20, ST_COLOR_YELLOW);
-    registerCallBack(standWithUkraine,xy,logoXY,BACKGROUD_CHANGED);
+void standWithUkraine(BaseSize_t size, const UkraineLayout_t* layout) {
+    u16 x = layout->x, y = layout->y;
+    u16 logoX = layout->logoX, logoY = layout->logoY;
+    LOG2(LOG_STAND_WITH_UA, x, y);
+    widgetLabel(&ukraineLabel, x, y, &Font_11x18, 1, THEME_COLOR(THEME_FOREGROUND), THEME_COLOR(THEME_BACKGROUND));
+    widgetSetText(&ui, &ukraineLabel, "WITH UKRAINE");
+    widgetBox(&flagTop, logoX, logoY, 60, 20, FIXED_COLOR(ST_COLOR_BLUE));
+    widgetBox(&flagBottom, logoX, logoY+20, 60, 20, FIXED_COLOR(ST_COLOR_YELLOW));
+    widgetAdd(&ui, &ukraineLabel);
+    widgetAdd(&ui, &flagTop);
+    widgetAdd(&ui, &flagBottom);
+    widgetsRender(&ui);
 }
 
-void testBtnClick(BaseSize_t count, BaseParam_t tickTime) {
-    Time_t ticks = (Time_t)tickTime;
-    printf("button clicked by %d ticks\n", ticks);
+void testBtnClick(BaseSize_t size, const ButtonEvent_t* click) {
+    LOG1(LOG_BTN_CLICK, click->heldUs / 1000);
 }
 
 void testBtnPressed() {
-    puts("button pressed");
+    LOG0(LOG_BTN_PRESSED);
 }
 
 void testBtnRelesed() {
-    puts("button released");
+    LOG0(LOG_BTN_RELEASED);
 }
 
 void testButton(){
-    connectTaskToSignal((TaskMng)testBtnClick, ClickEvent);
-    connectTaskToSignal((TaskMng)testBtnPressed, PressedEvent);
-    connectTaskToSignal((TaskMng)testBtnRelesed, ReleasedEvent);
+    schedConnect((TaskMng)testBtnClick, ClickEvent);
+    schedConnect((TaskMng)testBtnPressed, PressedEvent);
+    schedConnect((TaskMng)testBtnRelesed, ReleasedEvent);
 }
 
 void disableDisplay(BaseSize_t arg_n, BaseParam_t arg_p);
 void enableDisplay(BaseSize_t n, BaseParam_t arguments);
-void stopwatchTask();
+void stopwatchTask(BaseSize_t size, const ButtonEvent_t* click);
 
-void invertColors(BaseSize_t count, BaseParam_t time) {
-    if((Time_t)time < TICK_PER_SECOND) return;
-    puts("INVERT COLORS IN SCREEN");
-    currentBackground = ST_COLOR_WHITE-currentBackground;
-    currentColor[0] = ST_COLOR_WHITE-currentColor[0];
-    currentColor[1] = ST_COLOR_WHITE-currentColor[1];
-    execCallBack(invertColors);
+// long click
+void invertColors(BaseSize_t size, const ButtonEvent_t* click) {
+    if(click->heldUs < 1000000 || stopwatchRunningAt(click->pressUs)) return; // that one stops the stopwatch
+    LOG0(LOG_INVERT_COLORS);
+    for(u08 slot = 0; slot < THEME_SLOTS; slot++) {
+        themeSet(&ui, slot, ST_COLOR_WHITE-themeGet(&ui, slot));
+    }
+    widgetsRender(&ui);
+    schedExecCallBack(invertColors);
+}
+
+#define STOPWATCH_REFRESH (TICK_PER_SECOND>>3) // redraw rate only, timing comes from time_us_64
+
+static void drawStopwatch(uint64_t elapsedUs) {
+    u32 hundredths = (u32)(elapsedUs % 1000000) / 10000;
+    char hundredthsStr[3] = {'0' + hundredths / 10, '0' + hundredths % 10, END_STRING};
+    widgetSetNumber(&ui, &swSeconds, (s32)(elapsedUs / 1000000));
+    widgetSetText(&ui, &swHundredths, hundredthsStr);
+    widgetsRender(&ui);
 }
 
-static u32 stopwatchTimer;
 static void showTimer() {
-    updateTimer(disableDisplay,0, NULL, TICK_PER_SECOND<<1);
-    u32 currentTicks = getTick();
-    u32 ticks = 0;
-    if(currentTicks > stopwatchTimer) {
-        ticks = currentTicks - stopwatchTimer;
-    } else {
-        ticks = 0xFFFFFFFF - stopwatchTimer + currentTicks;
-    }
-    Time_t seconds = ticks / TICK_PER_SECOND;
-    ticks %= TICK_PER_SECOND;
-    char secondsStr[10];
-    char ticksStr[5];
-    toStringDec(seconds, secondsStr);
-    toStringDec(ticks, ticksStr);
-    st7789_write_string(10, SCREEN_HEIGHT/2-10, "sec:", Font_16x26, currentColor[0], currentBackground);
-    st7789_write_string(10+strSize("sec:")*16, SCREEN_HEIGHT/2-10, secondsStr, Font_16x26, currentColor[0], currentBackground);
-    st7789_write_string(SCREEN_WIDTH-strSize(ticksStr)*16-10, SCREEN_HEIGHT/2-10, ticksStr, Font_16x26, currentColor[1], currentBackground);
+    schedRestart(&displayOffTimer, disableDisplay, 0, NULL, TICK_PER_SECOND<<1);
+    drawStopwatch(stopwatchElapsed(time_us_64()));
+}
+
+// "lap 3 12.34", number and duration of the most recent lap
+static void showLap() {
+    char lapStr[24] = "lap ";
+    uint64_t lapUs = stopwatchGetLap(0);
+    u32 hundredths = (u32)(lapUs % 1000000) / 10000;
+    toStringDec(stopwatchLapCount(), lapStr + strSize(lapStr));
+    u08 end = strSize(lapStr);
+    lapStr[end++] = ' ';
+    toStringDec((s32)(lapUs / 1000000), lapStr + end);
+    end = strSize(lapStr);
+    lapStr[end++] = '.';
+    lapStr[end++] = '0' + hundredths / 10;
+    lapStr[end++] = '0' + hundredths % 10;
+    lapStr[end] = END_STRING;
+    widgetSetText(&ui, &swLap, lapStr);
+    widgetSetVisible(&ui, &swLap, TRUE);
+    widgetsRender(&ui);
+}
+
+static void setStopwatchVisible(bool_t visible) {
+#ifdef ANALOG_CLOCK
+    if(visible) clockFaceSetVisible(&face, FALSE);
+#endif
+    widgetSetVisible(&ui, &swCaption, visible);
+    widgetSetVisible(&ui, &swSeconds, visible);
+    widgetSetVisible(&ui, &swHundredths, visible);
+    widgetSetVisible(&ui, &swLap, FALSE);
 }
 
 void clearStopWatchScreen() {
-    st7789_draw_filled_rectangle(10, SCREEN_HEIGHT/2-10, SCREEN_WIDTH, 26, currentBackground);
-    execCallBack(clearStopWatchScreen);
+    setStopwatchVisible(FALSE);
+    widgetsRender(&ui);
+#ifdef ANALOG_CLOCK
+    clockFaceSetVisible(&face, TRUE); // the whole face comes back with the next second
+#endif
+    schedExecCallBack(clearStopWatchScreen);
 }
 
-void stopwatchTask(BaseSize_t count, BaseParam_t time) {
-    static u08 state = 0;
-    Time_t t = (Time_t)time;
-    if(t > TICK_PER_SECOND) {
+// short click starts and takes laps, long click stops, timed from the press edge
+void stopwatchTask(BaseSize_t size, const ButtonEvent_t* click) {
+    bool_t longClick = click->heldUs >= 1000000;
+    if(!stopwatchIsRunning() && longClick) {
         return;
     }
-    if(state) {
-        SetTask((TaskMng)delCycleTask, 0, (BaseParam_t)showTimer);
-        updateTimer(disableDisplay, 0, NULL, displayOnTimeout*TICK_PER_SECOND);
-        state = 0;
-        execCallBack(stopwatchTask);
+    if(stopwatchIsRunning() && !longClick) {
+        stopwatchLap(click->pressUs);
+        showLap();
         return;
     }
-    state++;
-    stopwatchTimer = getTick();
-    clearStopWatchScreen();
-    SetCycleTask(TICK_PER_SECOND>>4, showTimer, TRUE);
+    if(stopwatchIsRunning()) {
+        schedCancel(&stopwatchCycle);
+        stopwatchStop(click->pressUs);
+        drawStopwatch(stopwatchElapsed(0));
+        showLap();
+        schedRestart(&displayOffTimer, disableDisplay, 0, NULL, displayOnTimeout*TICK_PER_SECOND);
+        schedExecCallBack(stopwatchTask);
+        return;
+    }
+    stopwatchStart(click->pressUs);
+    setStopwatchVisible(TRUE);
+    stopwatchCycle = schedCycleDeadline(STOPWATCH_REFRESH, showTimer, STOPWATCH_REFRESH, SCHED_PRIO(SCHED_PRIO_NORMAL));
 }
 
+#ifdef ALWAYS_ON_CLOCK
+// Only hours and minutes stay on. In rotation 3 the gate lines run along screen
+// columns, so the band is the time label's width over the full height and
+// everything else is hidden rather than cut off at the band edges.
+static void setAlwaysOnLayout(bool_t on) {
+    Widget_t* hidden[] = {&dateLabel, &secondsLabel, &ukraineLabel, &flagTop, &flagBottom};
+    for(u08 i = 0; i < sizeof(hidden)/sizeof(hidden[0]); i++) {
+        widgetSetVisible(&ui, hidden[i], !on);
+    }
+#ifdef ANALOG_CLOCK
+    clockFaceSetVisible(&face, !on);
+#endif
+    widgetsRender(&ui);
+}
+#endif
+
 void disableDisplay(BaseSize_t arg_n, BaseParam_t arg_p) {
-    disconnectTaskFromSignal(stopwatchTask, ClickEvent);
-    disconnectTaskFromSignal(invertColors, ClickEvent);
-    connectTaskToSignal(enableDisplay, ReleasedEvent);
-	delCycleTask(arg_n, showTimeDate);
+    schedDisconnect((TaskMng)stopwatchTask, ClickEvent);
+    schedDisconnect((TaskMng)invertColors, ClickEvent);
+    schedConnect(enableDisplay, ReleasedEvent);
+#ifdef ANALOG_CLOCK
+    schedDisconnect((TaskMng)showFace, SecondsChangedEvent); // the panel keeps the hands where they are
+#endif
     clearStopWatchScreen();
-	display_enable(false);
-	execCallBack(disableDisplay);
+#ifdef ALWAYS_ON_CLOCK
+    // keep the clock running in 8 colors, scanning only the gate lines under it
+    setAlwaysOnLayout(TRUE);
+    Rect_t band = timeLabel.shown;
+    if(!timeLabel.drawn || !st7789_partial_band(&screen, band.x, band.y, band.x + band.w - 1, band.y + band.h - 1)) {
+        LOG0(LOG_PARTIAL_UNAVAILABLE);
+    }
+    st7789_idle_mode(&screen, TRUE);
+#else
+	schedCancel(&clockCycle);
+	display_enable(&screen, false);
+	st7789_sleep(&screen);
+#endif
+	setClockProfile(CLOCK_PROFILE_LOW);
+	schedExecCallBack(disableDisplay);
 }
 
-void enableDisplay(BaseSize_t n, BaseParam_t arguments) {
-    disconnectTaskFromSignal(enableDisplay, ReleasedEvent);
-    connectTaskToSignal(stopwatchTask, ClickEvent);
-    connectTaskToSignal(invertColors, ClickEvent);
-	Time_t seconds = displayOnTimeout;
-	if(n>0) {
-		seconds = toIntDec(arguments);
-	}
-	display_enable(true);
-	SetCycleTask(TICK_PER_SECOND, showTimeDate, TRUE);
-	SetTimerTask(disableDisplay,0, NULL, seconds*TICK_PER_SECOND);
-	execCallBack(enableDisplay);
+static void displayAwake(BaseSize_t n, BaseParam_t lcd) {
+    if(lcd != &screen) return;
+    schedDisconnect(displayAwake, St7789ReadyEvent);
+	display_enable(&screen, true);
+#ifdef ANALOG_CLOCK
+    schedConnect((TaskMng)showFace, SecondsChangedEvent);
+#endif
+	clockCycle = schedCycleDeadline(TICK_PER_SECOND, showTimeDate, TICK_PER_SECOND>>1, SCHED_PRIO(SCHED_PRIO_NORMAL) | SCHED_CRITICAL);
+}
+
+// ReleasedEvent carries no payload, a posted Time_t overrides the timeout in seconds.
+void enableDisplay(BaseSize_t size, BaseParam_t seconds) {
+    schedDisconnect(enableDisplay, ReleasedEvent);
+    schedConnect((TaskMng)stopwatchTask, ClickEvent);
+    schedConnect((TaskMng)invertColors, ClickEvent);
+	Time_t timeout = size == sizeof(Time_t) ? *(const Time_t*)seconds : displayOnTimeout;
+	setClockProfile(CLOCK_PROFILE_NORMAL);
+#ifdef ALWAYS_ON_CLOCK
+    st7789_idle_mode(&screen, FALSE);
+    st7789_normal_mode(&screen);
+    setAlwaysOnLayout(FALSE);
+    schedCancel(&clockCycle);
+    displayAwake(0, &screen);
+#else
+    schedConnect(displayAwake, St7789ReadyEvent);
+    st7789_wake(&screen);
+#endif
+	schedRestart(&displayOffTimer, disableDisplay, 0, NULL, timeout*TICK_PER_SECOND);
+	schedExecCallBack(enableDisplay);
+}
+
+// The driver emits through femtox, these permanent connections hand its events to
+// the scheduler so the app connects to them with schedConnect like everything else.
+static void forwardReady(BaseSize_t n, BaseParam_t lcd) {
+    schedEmit(St7789ReadyEvent, n, lcd);
+}
+
+#ifdef DISPLAY_MIRROR
+static void forwardMirrorResync(BaseSize_t n, BaseParam_t lcd) {
+    schedEmit(St7789MirrorResyncEvent, n, lcd);
+}
+#endif
+
+static void appIdle() {
+#ifdef DISPLAY_MIRROR
+    // log frames must not land inside a half written mirror frame
+    if(get_core_num() == 0 && !st7789_mirror_pump()) logDrain();
+#else
+    if(get_core_num() == 0) logDrain();
+#endif
+    idle();
 }
 
 static void displayCtr() {
-    connectTaskToSignal(enableDisplay, ReleasedEvent);
+    schedConnect(enableDisplay, ReleasedEvent);
+}
+
+static void core1Main() {
+    initClockProfileCore();
+    runFemtOS();
+}
+
+#ifdef DUAL_DISPLAY
+static void initDisplay2(struct st7789_config* display) {
+    display->spi = spi1;
+    display->clk_perif_khz = getClockProfileKhz(getClockProfile());
+    display->gpio_din = SPI1_TX;
+    display->gpio_clk = SPI1_SCK;
+    display->gpio_bl = DISPLAY2_ON;
+    display->gpio_dc = DISPLAY2_DC;
+    display->gpio_rst = DISPLAY2_RST;
+    display->pixel_format = ST7789_FORMAT_RGB565;
+}
+
+// static screen, recorded once at init and replayed by DMA, the panel never sleeps
+static u16 flagList[2 * (ST7789_DLIST_WINDOW + 2)];
+static struct st7789_dlist_block flagBlocks[5];
+static struct st7789_dlist flag;
+
+static void display2Ready(struct st7789* lcd) {
+    st7789_rotate_display(lcd, 3);
+    if(flag.buf == NULL) {
+        st7789_dlist_begin(&flag, flagList, sizeof(flagList)/sizeof(flagList[0]), flagBlocks, sizeof(flagBlocks)/sizeof(flagBlocks[0]));
+        st7789_dlist_rect(&flag, 0, 0, SCREEN_WIDTH, SCREEN_HEIGHT/2, ST_COLOR_BLUE);
+        st7789_dlist_rect(&flag, 0, SCREEN_HEIGHT/2, SCREEN_WIDTH, SCREEN_HEIGHT/2, ST_COLOR_YELLOW);
+        st7789_dlist_end(&flag);
+    }
+    st7789_dlist_replay(lcd, &flag);
+    display_enable(lcd, true);
+}
+#endif
+
+#ifdef DISPLAY_MIRROR
+static void mirrorResync(BaseSize_t n, BaseParam_t lcd) {
+    widgetsInvalidate(&ui);
+    widgetsRender(&ui);
+#ifdef ANALOG_CLOCK
+    clockFaceInvalidate(&face);
+#endif
+}
+#endif
+
+static bool_t benchmarkMode; // BUTTON held at boot
+
+static void screenReady() {
+    LOG2(LOG_DISPLAY_STARTUP, screen.ready_us, (u32)(time_us_64() / 1000));
+    st7789_rotate_display(&screen, 3);
+    st7789_dlist_attach(&screen, pio0);
+    if(benchmarkMode) {
+        benchmarkStart(&screen);
+        return;
+    }
+#ifdef DISPLAY_MIRROR
+    schedConnect(mirrorResync, St7789MirrorResyncEvent);
+    st7789_mirror_start(&screen);
+#endif
+    widgetsRender(&ui); // first render fills the background
+#ifdef ANALOG_CLOCK
+    schedConnect((TaskMng)showFace, SecondsChangedEvent);
+#endif
+    schedTask((TaskMng)displayCtr, 0, NULL);
+    SCHED_POST(standWithUkraine, SCHED_PRIO_NORMAL, UkraineLayout_t, .x = 20, .y = SCREEN_HEIGHT-40, .logoX = SCREEN_WIDTH-60, .logoY = SCREEN_HEIGHT-40);
+#ifndef ALWAYS_ON_CLOCK
+    st7789_sleep(&screen); // frame memory still accepts the first drawing while asleep
+#endif
+}
+
+static void displayReady(BaseSize_t n, BaseParam_t arg_p) {
+#ifdef DUAL_DISPLAY
+    if(arg_p == &screen2) display2Ready(&screen2);
+    else screenReady();
+    if(!st7789_is_ready(&screen) || !st7789_is_ready(&screen2)) return;
+#else
+    screenReady();
+#endif
+    schedDisconnect(displayReady, St7789ReadyEvent);
 }
 
 int main() {
-    // Set the system frequency to 133 MHz. vco_calc.py from the SDK tells us
-    // this is exactly attainable at the PLL from a 12 MHz crystal: FBDIV =
-    // 133 (so VCO of 1596 MHz), PD1 = 6, PD2 = 2. This function will set the
-    // system PLL to 133 MHz and set the clk_sys divisor to 1.
-    set_sys_clock_khz(PLL_SYS_KHZ, true);
-
-    // The previous line automatically detached clk_peri from clk_sys, and
-    // attached it to pll_usb, so that clk_peri won't be disturbed by future
-    // changes to system clock or system PLL. If we need higher clk_peri
-    // frequencies, we can attach clk_peri directly back to system PLL (no
-    // divider available) and then use the clk_sys divider to scale clk_sys
-    // independently of clk_peri.
-    clock_configure(
-        clk_peri,
-        CLOCKS_CLK_PERI_CTRL_AUXSRC_RESET,                // No glitchless mux
-        CLOCKS_CLK_PERI_CTRL_AUXSRC_VALUE_CLKSRC_PLL_SYS, // System PLL on AUX mux
-        PLL_SYS_KHZ * KHZ,                               // Input frequency
-        PLL_SYS_KHZ * KHZ                                // Output (must be same as no divider)
-    );
+    initClockProfile(CLOCK_PROFILE_NORMAL);
+    addClockProfileHook(displayClockHook);
 
     stdio_init_all();
+    initLogRing();
     initLED();
     initInput();
-    struct st7789_config display;
-    initDisplay(&display);
-    for(uint8_t i = 0; i<3; i++) {
-        st7789_init(&display, SCREEN_WIDTH, SCREEN_HEIGHT);
-    }
-    st7789_fill(currentBackground);
-    st7789_rotate_display(3);
+    benchmarkMode = !gpio_get(BUTTON);
+    initStopwatch();
     initFemtOS();
+    initSched();
+    schedConnect(schedOverflow, SchedOverflowEvent);
     setSeconds(1645653600); // 24.02.22 russia-ukraine war start
     initWatchDog();
-    SetCycleTask(TICK_PER_SECOND>>1, resetWatchDog, TRUE);
-    SetIdleTask(idle);
-    SetTask((TaskMng)testButton, 0, NULL);
-    SetTask((TaskMng)displayCtr, 0, NULL);
-    SetTask(standWithUkraine, (SCREEN_HEIGHT-40)<<16|20, (BaseParam_t)(((u32)(SCREEN_HEIGHT-40))<<16 | (SCREEN_WIDTH-60)));
+    schedConnect(deadlineMissed, SchedDeadlineMissEvent);
+    schedCycleDeadline(WATCHDOG_FEED_PERIOD, feedWatchDog, WATCHDOG_FEED_PERIOD>>1, SCHED_PRIO(SCHED_PRIO_TIMING) | SCHED_CRITICAL);
+    SetIdleTask(appIdle);
+    schedTask((TaskMng)testButton, 0, NULL);
+    struct st7789_config display;
+    initDisplay(&display);
+    initUi();
+    connectTaskToSignal(forwardReady, St7789ReadyEvent);
+#ifdef DISPLAY_MIRROR
+    connectTaskToSignal(forwardMirrorResync, St7789MirrorResyncEvent);
+#endif
+    schedConnect(displayReady, St7789ReadyEvent);
+    st7789_init(&screen, &display, SCREEN_WIDTH, SCREEN_HEIGHT);
+#ifdef DUAL_DISPLAY
+    initDisplay2(&display);
+    st7789_init(&screen2, &display, SCREEN_WIDTH, SCREEN_HEIGHT);
+#endif
     for(int i = 1; i<30; i++) {
-        SetTimerTask((TaskMng)test1, i, NULL, TICK_PER_SECOND*i);
+        schedTimer((TaskMng)test1, i, NULL, TICK_PER_SECOND*i);
     }
-    multicore_launch_core1(runFemtOS);
+#ifdef LATENCY_BENCH
+    schedTimer(latencyBenchTask, 0, NULL, TICK_PER_SECOND*3);
+#endif
+#ifdef BLIT_BENCH
+    schedTimer(blitBenchTask, 0, NULL, TICK_PER_SECOND);
+#endif
+#ifdef XIP_PROFILE
+    if(!benchmarkMode) schedCycle(TICK_PER_SECOND*XIP_PROFILE_SECONDS, xipProfile); // the benchmark reads the counters itself
+#endif
+    multicore_launch_core1(core1Main);
+    initClockProfileCore();
     runFemtOS();
     return 0;
 }
@@ -0,0 +1,559 @@
+#include "sched.h"
+
+#include <string.h>
+
+#include <pico/sync.h>
+
+// Every task on both cores passes through the dispatch path, with SCHED_RAM_FUNCS
+// it runs from SRAM and stays out of the XIP cache the two cores share.
+#ifdef SCHED_RAM_FUNCS
+#define SCHED_HOT(name) __not_in_flash_func(name)
+#else
+#define SCHED_HOT(name) name
+#endif
+
+// Every entry starts with its link, it chains the free list while the entry is
+// free and the owner's queue or list while it is in use.
+typedef struct TaskEntry {
+    struct TaskEntry* next;
+    TaskMng task;
+    BaseSize_t n; // payload size when SCHED_HAS_PAYLOAD is set
+    union {
+        BaseParam_t p;
+        u08 payload[SCHED_PAYLOAD_SIZE];
+    };
+    u32 deadline; // absolute tick, the ready queue is kept in this order
+    u32 owner; // handle of the cycle that released it, SCHED_NONE otherwise
+    u08 flags;
+} TaskEntry_t;
+
+typedef struct TimerEntry {
+    struct TimerEntry* next;
+    TaskMng task;
+    BaseSize_t n;
+    BaseParam_t p;
+    u32 deadline; // getTick() value
+    Time_t period; // 0 for one shot timers
+    Time_t relDeadline; // after the release time, SCHED_NO_DEADLINE for background work
+    u08 flags;
+    u16 gen;
+    u08 pool;
+    bool_t active;
+} TimerEntry_t;
+
+typedef struct SlotEntry {
+    struct SlotEntry* next;
+    TaskMng task;
+    const void* signal;
+} SlotEntry_t;
+
+typedef struct CallBackEntry {
+    struct CallBackEntry* next;
+    TaskMng task;
+    BaseSize_t n;
+    BaseParam_t p;
+    const void* key;
+} CallBackEntry_t;
+
+typedef struct {
+    void* base;
+    u16 size;
+    u16 capacity;
+    void* free;
+    u16 used;
+    u16 highWater;
+    u32 overflows;
+} Pool_t;
+
+static TaskEntry_t tasks[SCHED_TASKS];
+static TimerEntry_t timers[SCHED_TIMERS];
+static TimerEntry_t cycles[SCHED_CYCLES];
+static SlotEntry_t slots[SCHED_SLOTS];
+static SchedDeadlineStats_t deadlineStats[SCHED_TRACKED];
+static CallBackEntry_t callBacks[SCHED_CALLBACKS];
+
+// handles keep the entry index in 8 bits
+static_assert(SCHED_TIMERS <= 256 && SCHED_CYCLES <= 256, "timer pools are limited to 256 entries");
+
+#define POOL(array) {array, sizeof(array[0]), sizeof(array)/sizeof(array[0]), NULL, 0, 0, 0}
+static Pool_t pools[SCHED_POOL_COUNT] = {
+    [SCHED_POOL_TASK]     = POOL(tasks),
+    [SCHED_POOL_TIMER]    = POOL(timers),
+    [SCHED_POOL_CYCLE]    = POOL(cycles),
+    [SCHED_POOL_SLOT]     = POOL(slots),
+    [SCHED_POOL_CALLBACK] = POOL(callBacks),
+};
+
+static spin_lock_t* schedLock;
+static TaskEntry_t* readyHead[SCHED_PRIORITIES]; // per level, earliest deadline first
+static u32 readyMask = 0; // bit per non-empty level
+static u16 readyCount = 0;
+static u08 dispatchers = 0;   // tokens in the femtox queue or running
+static u08 pendingTokens = 0; // tokens to post once the lock is released
+static TimerEntry_t* timerList = NULL; // sorted by deadline
+static SlotEntry_t* slotList = NULL;
+static CallBackEntry_t* callBackList = NULL;
+static u32 overflowPending = 0; // bit per pool
+static bool_t overflowPosted = FALSE;
+static bool_t criticalMissed = FALSE;
+
+#define SCHED_HAS_DEADLINE 0x80 // internal flags next to SCHED_CRITICAL
+#define SCHED_HAS_PAYLOAD 0x40
+#define SCHED_PRIO_OF(flags) (((flags) >> 4) & (SCHED_PRIORITIES - 1))
+
+static void schedDispatch(BaseSize_t n, BaseParam_t p);
+static void schedOverflowTask(BaseSize_t n, BaseParam_t p);
+static void deadlineCheck(TaskMng task, u32 deadline, u08 flags);
+const void* SchedOverflowEvent = (void*)schedOverflowTask;
+const void* SchedDeadlineMissEvent = (void*)deadlineCheck;
+
+static u32 SCHED_HOT(schedLockEnter)() {
+    return spin_lock_blocking(schedLock);
+}
+
+// femtox calls are kept out of the spin lock, they post what the locked part decided
+static void SCHED_HOT(schedLockExit)(u32 irq) {
+    bool_t postOverflow = overflowPending && !overflowPosted;
+    if(postOverflow) overflowPosted = TRUE;
+    u08 tokens = pendingTokens;
+    pendingTokens = 0;
+    spin_unlock(schedLock, irq);
+    while(tokens--) SetTask(schedDispatch, 0, NULL);
+    if(postOverflow) SetTask(schedOverflowTask, 0, NULL);
+}
+
+static void poolInit(Pool_t* pool) {
+    pool->free = NULL;
+    for(u16 i = pool->capacity; i--;) {
+        void** item = (void**)((u08*)pool->base + i * pool->size);
+        *item = pool->free;
+        pool->free = item;
+    }
+}
+
+static void* SCHED_HOT(poolAlloc)(SchedPool_t id) {
+    Pool_t* pool = &pools[id];
+    void** item = pool->free;
+    if(item == NULL) {
+        pool->overflows++;
+        overflowPending |= 1 << id;
+        return NULL;
+    }
+    pool->free = *item;
+    if(++pool->used > pool->highWater) pool->highWater = pool->used;
+    return item;
+}
+
+static void SCHED_HOT(poolFree)(SchedPool_t id, void* item) {
+    Pool_t* pool = &pools[id];
+    *(void**)item = pool->free;
+    pool->free = item;
+    pool->used--;
+}
+
+// Tasks without a deadline get one SCHED_BACKGROUND_SLACK after release, so EDF
+// still serves them eventually instead of starving them behind periodic work.
+static TaskEntry_t* SCHED_HOT(enqueue)(TaskMng task, BaseSize_t n, BaseParam_t p, u32 release, Time_t deadline, u08 flags) {
+    TaskEntry_t* entry = poolAlloc(SCHED_POOL_TASK);
+    if(entry == NULL) return NULL;
+    entry->task = task;
+    entry->n = n;
+    entry->p = p;
+    entry->owner = SCHED_NONE;
+    entry->flags = flags;
+    if(deadline != SCHED_NO_DEADLINE) entry->flags |= SCHED_HAS_DEADLINE;
+    else deadline = SCHED_BACKGROUND_SLACK;
+    entry->deadline = release + deadline;
+    u08 level = SCHED_PRIO_OF(flags);
+    TaskEntry_t** link = &readyHead[level];
+    while(*link && (s32)((*link)->deadline - entry->deadline) <= 0) link = &(*link)->next;
+    entry->next = *link;
+    *link = entry;
+    readyMask |= 1 << level;
+    readyCount++;
+    if(dispatchers < SCHED_DISPATCHERS && dispatchers < readyCount) {
+        dispatchers++;
+        pendingTokens++;
+    }
+    return entry;
+}
+
+static bool_t enqueuePayload(TaskMng task, const void* payload, u08 size, u08 priority) {
+    TaskEntry_t* entry = enqueue(task, size, NULL, getTick(), SCHED_NO_DEADLINE, SCHED_PRIO(priority));
+    if(entry == NULL) return FALSE;
+    memcpy(entry->payload, payload, size);
+    entry->flags |= SCHED_HAS_PAYLOAD;
+    return TRUE;
+}
+
+static SchedDeadlineStats_t* deadlineStatsFor(TaskMng task, bool_t add) {
+    for(u08 i = 0; i < SCHED_TRACKED; i++) {
+        if(deadlineStats[i].task == task) return &deadlineStats[i];
+        if(deadlineStats[i].task == NULL) {
+            if(!add) return NULL;
+            deadlineStats[i].task = task;
+            return &deadlineStats[i];
+        }
+    }
+    return NULL;
+}
+
+// Lateness is taken at completion, it covers both a late start and an overrun.
+static void deadlineCheck(TaskMng task, u32 deadline, u08 flags) {
+    s32 late = (s32)(getTick() - deadline);
+    u32 irq = schedLockEnter();
+    SchedDeadlineStats_t* stats = deadlineStatsFor(task, TRUE);
+    if(stats != NULL) stats->runs++;
+    if(late > 0) {
+        if(stats != NULL) {
+            stats->misses++;
+            if((Time_t)late > stats->worstLateness) stats->worstLateness = late;
+        }
+        if(flags & SCHED_CRITICAL) criticalMissed = TRUE;
+        for(SlotEntry_t* slot = slotList; slot; slot = slot->next) {
+            if(slot->signal == SchedDeadlineMissEvent) enqueue(slot->task, late, (BaseParam_t)task, getTick(), SCHED_NO_DEADLINE, SCHED_PRIO(SCHED_PRIO_TIMING));
+        }
+    }
+    schedLockExit(irq);
+}
+
+static void SCHED_HOT(schedDispatch)(BaseSize_t n, BaseParam_t p) {
+    u08 payload[SCHED_PAYLOAD_SIZE] __attribute__((aligned(8)));
+    for(u08 run = 0;; run++) {
+        u32 irq = schedLockEnter();
+        // highest non-empty level in O(1), the queue is only looked at between tasks
+        u08 level = readyMask ? 31 - __builtin_clz(readyMask) : 0;
+        TaskEntry_t* entry = readyHead[level];
+        if(entry == NULL || run == SCHED_DISPATCH_BATCH) {
+            if(entry == NULL) dispatchers--;
+            else pendingTokens++; // let femtox run its own tasks, then continue
+            schedLockExit(irq);
+            return;
+        }
+        readyHead[level] = entry->next;
+        if(readyHead[level] == NULL) readyMask &= ~(1 << level);
+        readyCount--;
+        TaskMng task = entry->task;
+        BaseSize_t taskN = entry->n;
+        BaseParam_t taskP = entry->p;
+        u32 deadline = entry->deadline;
+        u08 flags = entry->flags;
+        if(flags & SCHED_HAS_PAYLOAD) {
+            // the handler gets its own copy, the entry goes back to the pool right away
+            memcpy(payload, entry->payload, taskN);
+            taskP = payload;
+        }
+        poolFree(SCHED_POOL_TASK, entry);
+        schedLockExit(irq);
+        task(taskN, taskP);
+        if(flags & SCHED_HAS_DEADLINE) deadlineCheck(task, deadline, flags);
+    }
+}
+
+static void schedOverflowTask(BaseSize_t n, BaseParam_t p) {
+    TaskMng handlers[SCHED_SLOTS];
+    u08 count = 0;
+    u32 irq = schedLockEnter();
+    u32 pending = overflowPending;
+    overflowPending = 0;
+    overflowPosted = FALSE;
+    for(SlotEntry_t* slot = slotList; slot; slot = slot->next) {
+        if(slot->signal == SchedOverflowEvent) handlers[count++] = slot->task;
+    }
+    schedLockExit(irq);
+    for(u08 pool = 0; pool < SCHED_POOL_COUNT; pool++) {
+        if(!(pending & (1 << pool))) continue;
+        for(u08 i = 0; i < count; i++) handlers[i](pool, NULL);
+    }
+}
+
+static void SCHED_HOT(timerInsert)(TimerEntry_t* timer) {
+    TimerEntry_t** link = &timerList;
+    while(*link && (s32)((*link)->deadline - timer->deadline) <= 0) link = &(*link)->next;
+    timer->next = *link;
+    *link = timer;
+}
+
+static void timerUnlink(TimerEntry_t* timer) {
+    for(TimerEntry_t** link = &timerList; *link; link = &(*link)->next) {
+        if(*link == timer) {
+            *link = timer->next;
+            return;
+        }
+    }
+}
+
+static void SCHED_HOT(timerRelease)(TimerEntry_t* timer) {
+    timer->active = FALSE;
+    if(++timer->gen == 0) timer->gen = 1;
+    poolFree(timer->pool, timer);
+}
+
+static SchedTimer_t timerHandle(TimerEntry_t* timer) {
+    Pool_t* pool = &pools[timer->pool];
+    u32 index = ((u08*)timer - (u08*)pool->base) / pool->size;
+    return (u32)timer->gen << 16 | (u32)timer->pool << 8 | index;
+}
+
+static TimerEntry_t* timerFromHandle(SchedTimer_t handle) {
+    u08 id = (handle >> 8) & 0xFF;
+    u08 index = handle & 0xFF;
+    if(id != SCHED_POOL_TIMER && id != SCHED_POOL_CYCLE) return NULL;
+    if(index >= pools[id].capacity) return NULL;
+    TimerEntry_t* timer = (TimerEntry_t*)pools[id].base + index;
+    return (timer->active && timer->gen == handle >> 16) ? timer : NULL;
+}
+
+static SchedTimer_t timerAdd(SchedPool_t id, TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay, Time_t period, Time_t deadline, u08 flags) {
+    SchedTimer_t handle = SCHED_NONE;
+    u32 irq = schedLockEnter();
+    TimerEntry_t* timer = poolAlloc(id);
+    if(timer != NULL) {
+        timer->task = task;
+        timer->n = n;
+        timer->p = p;
+        timer->deadline = getTick() + delay;
+        timer->period = period;
+        timer->relDeadline = deadline;
+        timer->flags = flags;
+        timer->pool = id;
+        timer->active = TRUE;
+        timerInsert(timer);
+        handle = timerHandle(timer);
+    }
+    schedLockExit(irq);
+    return handle;
+}
+
+// Runs every tick as the only femtox cycle owned by the scheduler and moves due
+// timers to the ready queue, ordered by the deadline they carry.
+static void SCHED_HOT(schedTimerPoll)() {
+    u32 now = getTick();
+    u32 irq = schedLockEnter();
+    for(;;) {
+        TimerEntry_t* timer = timerList;
+        if(timer == NULL || (s32)(timer->deadline - now) > 0) break;
+        timerList = timer->next;
+        TaskEntry_t* entry = enqueue(timer->task, timer->n, timer->p, timer->deadline, timer->relDeadline, timer->flags);
+        if(timer->period) {
+            if(entry != NULL) entry->owner = timerHandle(timer);
+            timer->deadline += timer->period;
+            if((s32)(timer->deadline - now) <= 0) timer->deadline = now + timer->period; // overrun, skip the missed periods
+            timerInsert(timer);
+        } else {
+            timerRelease(timer);
+        }
+    }
+    schedLockExit(irq);
+}
+
+void initSched() {
+    schedLock = spin_lock_init(spin_lock_claim_unused(true));
+    for(u08 id = 0; id < SCHED_POOL_COUNT; id++) poolInit(&pools[id]);
+    for(u16 i = 0; i < SCHED_TIMERS; i++) timers[i].gen = 1;
+    for(u16 i = 0; i < SCHED_CYCLES; i++) cycles[i].gen = 1;
+    SetCycleTask(1, schedTimerPoll, TRUE);
+}
+
+bool_t schedTask(TaskMng task, BaseSize_t n, BaseParam_t p) {
+    return schedTaskPrio(task, n, p, SCHED_PRIO_NORMAL);
+}
+
+bool_t schedTaskPrio(TaskMng task, BaseSize_t n, BaseParam_t p, u08 priority) {
+    u32 irq = schedLockEnter();
+    bool_t queued = enqueue(task, n, p, getTick(), SCHED_NO_DEADLINE, SCHED_PRIO(priority)) != NULL;
+    schedLockExit(irq);
+    return queued;
+}
+
+bool_t schedTaskPayload(TaskMng task, const void* payload, u08 size, u08 priority) {
+    if(size > SCHED_PAYLOAD_SIZE) return FALSE;
+    u32 irq = schedLockEnter();
+    bool_t queued = enqueuePayload(task, payload, size, priority);
+    schedLockExit(irq);
+    return queued;
+}
+
+SchedTimer_t schedTimer(TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay) {
+    return timerAdd(SCHED_POOL_TIMER, task, n, p, delay, 0, SCHED_NO_DEADLINE, SCHED_PRIO(SCHED_PRIO_NORMAL));
+}
+
+SchedTimer_t schedTimerPrio(TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay, u08 priority) {
+    return timerAdd(SCHED_POOL_TIMER, task, n, p, delay, 0, SCHED_NO_DEADLINE, SCHED_PRIO(priority));
+}
+
+SchedTimer_t schedTimerDeadline(TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay, Time_t deadline, u08 flags) {
+    return timerAdd(SCHED_POOL_TIMER, task, n, p, delay, 0, deadline, flags);
+}
+
+SchedTimer_t schedCycle(Time_t period, CycleFuncPtr func) {
+    return timerAdd(SCHED_POOL_CYCLE, (TaskMng)func, 0, NULL, period, period, SCHED_NO_DEADLINE, SCHED_PRIO(SCHED_PRIO_NORMAL));
+}
+
+SchedTimer_t schedCycleDeadline(Time_t period, CycleFuncPtr func, Time_t deadline, u08 flags) {
+    return timerAdd(SCHED_POOL_CYCLE, (TaskMng)func, 0, NULL, period, period, deadline, flags);
+}
+
+// Instances a cancelled cycle already released must not run after schedCancel returns.
+static void readyPurge(SchedTimer_t owner) {
+    for(u08 level = 0; level < SCHED_PRIORITIES; level++) {
+        for(TaskEntry_t** link = &readyHead[level]; *link;) {
+            TaskEntry_t* entry = *link;
+            if(entry->owner != owner) {
+                link = &entry->next;
+                continue;
+            }
+            *link = entry->next;
+            poolFree(SCHED_POOL_TASK, entry);
+            readyCount--;
+        }
+        if(readyHead[level] == NULL) readyMask &= ~(1 << level);
+    }
+}
+
+bool_t schedCancel(SchedTimer_t* timer) {
+    u32 irq = schedLockEnter();
+    TimerEntry_t* entry = timerFromHandle(*timer);
+    if(entry != NULL) {
+        if(entry->period) readyPurge(*timer);
+        timerUnlink(entry);
+        timerRelease(entry);
+    }
+    schedLockExit(irq);
+    *timer = SCHED_NONE;
+    return entry != NULL;
+}
+
+bool_t schedRestart(SchedTimer_t* timer, TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay) {
+    u32 irq = schedLockEnter();
+    TimerEntry_t* entry = timerFromHandle(*timer);
+    if(entry != NULL) {
+        timerUnlink(entry);
+        entry->deadline = getTick() + delay;
+        timerInsert(entry);
+    }
+    schedLockExit(irq);
+    if(entry == NULL) *timer = schedTimer(task, n, p, delay);
+    return *timer != SCHED_NONE;
+}
+
+bool_t schedConnect(TaskMng task, const void* signal) {
+    u32 irq = schedLockEnter();
+    SlotEntry_t** link = &slotList;
+    for(; *link; link = &(*link)->next) {
+        if((*link)->task == task && (*link)->signal == signal) {
+            schedLockExit(irq);
+            return TRUE;
+        }
+    }
+    SlotEntry_t* slot = poolAlloc(SCHED_POOL_SLOT);
+    if(slot != NULL) {
+        slot->next = NULL;
+        slot->task = task;
+        slot->signal = signal;
+        *link = slot; // keep connection order for emission
+    }
+    schedLockExit(irq);
+    return slot != NULL;
+}
+
+void schedDisconnect(TaskMng task, const void* signal) {
+    u32 irq = schedLockEnter();
+    for(SlotEntry_t** link = &slotList; *link; link = &(*link)->next) {
+        SlotEntry_t* slot = *link;
+        if(slot->task == task && slot->signal == signal) {
+            *link = slot->next;
+            poolFree(SCHED_POOL_SLOT, slot);
+            break;
+        }
+    }
+    schedLockExit(irq);
+}
+
+void schedEmit(const void* signal, BaseSize_t n, BaseParam_t p) {
+    schedEmitPrio(signal, n, p, SCHED_PRIO_NORMAL);
+}
+
+void schedEmitPrio(const void* signal, BaseSize_t n, BaseParam_t p, u08 priority) {
+    u32 irq = schedLockEnter();
+    for(SlotEntry_t* slot = slotList; slot; slot = slot->next) {
+        if(slot->signal == signal) enqueue(slot->task, n, p, getTick(), SCHED_NO_DEADLINE, SCHED_PRIO(priority));
+    }
+    schedLockExit(irq);
+}
+
+void schedEmitPayload(const void* signal, const void* payload, u08 size, u08 priority) {
+    if(size > SCHED_PAYLOAD_SIZE) return;
+    u32 irq = schedLockEnter();
+    for(SlotEntry_t* slot = slotList; slot; slot = slot->next) {
+        if(slot->signal == signal) enqueuePayload(slot->task, payload, size, priority);
+    }
+    schedLockExit(irq);
+}
+
+bool_t schedCallBack(TaskMng task, BaseSize_t n, BaseParam_t p, const void* key) {
+    u32 irq = schedLockEnter();
+    CallBackEntry_t* callBack = poolAlloc(SCHED_POOL_CALLBACK);
+    if(callBack != NULL) {
+        CallBackEntry_t** link = &callBackList;
+        while(*link) link = &(*link)->next;
+        callBack->next = NULL;
+        callBack->task = task;
+        callBack->n = n;
+        callBack->p = p;
+        callBack->key = key;
+        *link = callBack;
+    }
+    schedLockExit(irq);
+    return callBack != NULL;
+}
+
+void schedExecCallBack(const void* key) {
+    u32 irq = schedLockEnter();
+    for(CallBackEntry_t** link = &callBackList; *link;) {
+        CallBackEntry_t* callBack = *link;
+        if(callBack->key != key) {
+            link = &callBack->next;
+            continue;
+        }
+        *link = callBack->next;
+        enqueue(callBack->task, callBack->n, callBack->p, getTick(), SCHED_NO_DEADLINE, SCHED_PRIO(SCHED_PRIO_NORMAL));
+        poolFree(SCHED_POOL_CALLBACK, callBack);
+    }
+    schedLockExit(irq);
+}
+
+void schedPoolStats(SchedPool_t pool, SchedPoolStats_t* stats) {
+    u32 irq = schedLockEnter();
+    stats->capacity = pools[pool].capacity;
+    stats->used = pools[pool].used;
+    stats->highWater = pools[pool].highWater;
+    stats->overflows = pools[pool].overflows;
+    schedLockExit(irq);
+}
+
+bool_t schedDeadlineStats(TaskMng task, SchedDeadlineStats_t* stats) {
+    u32 irq = schedLockEnter();
+    SchedDeadlineStats_t* found = deadlineStatsFor(task, FALSE);
+    if(found != NULL) *stats = *found;
+    schedLockExit(irq);
+    return found != NULL;
+}
+
+bool_t schedCriticalOk() {
+    u32 now = getTick();
+    u32 irq = schedLockEnter();
+    bool_t ok = !criticalMissed;
+    criticalMissed = FALSE;
+    // still queued past the deadline, or never released because the poll starved
+    for(u08 level = 0; level < SCHED_PRIORITIES; level++) {
+        for(TaskEntry_t* entry = readyHead[level]; entry && ok; entry = entry->next) {
+            if((entry->flags & SCHED_CRITICAL) && (s32)(now - entry->deadline) > 0) ok = FALSE;
+        }
+    }
+    for(TimerEntry_t* timer = timerList; timer && ok; timer = timer->next) {
+        if((timer->flags & SCHED_CRITICAL) && (s32)(now - timer->deadline - timer->relDeadline) > 0) ok = FALSE;
+    }
+    schedLockExit(irq);
+    return ok;
+}
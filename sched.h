@@ -0,0 +1,136 @@
+#ifndef SCHED_H_
+#define SCHED_H_
+
+#include "femtox/TaskMngr.h"
+
+// Application scheduling on top of femtox. Every task, timer, cycle, signal slot
+// and callback lives in a fixed pool sized at compile time, allocation and release
+// are O(1) free list operations and a full pool refuses the request, counts it and
+// emits SchedOverflowEvent instead of dropping it silently. femtox itself only
+// carries the dispatcher tokens and one timer poll cycle.
+#ifndef SCHED_TASKS
+#define SCHED_TASKS 32     // queued tasks waiting for a dispatcher
+#endif
+#ifndef SCHED_TIMERS
+#define SCHED_TIMERS 48    // one shot timers, test1 alone keeps 29 of them armed
+#endif
+#ifndef SCHED_CYCLES
+#define SCHED_CYCLES 8
+#endif
+#ifndef SCHED_SLOTS
+#define SCHED_SLOTS 16     // signal connections
+#endif
+#ifndef SCHED_CALLBACKS
+#define SCHED_CALLBACKS 8
+#endif
+
+#ifndef SCHED_TRACKED
+#define SCHED_TRACKED 8    // tasks with deadline statistics
+#endif
+
+#ifndef SCHED_PAYLOAD_SIZE
+#define SCHED_PAYLOAD_SIZE 16 // bytes of inline payload in every task entry
+#endif
+
+#define SCHED_DISPATCHERS 2    // dispatcher tokens in the femtox queue, one per core
+#define SCHED_DISPATCH_BATCH 8 // tasks run per token before yielding back to femtox
+
+typedef enum {
+    SCHED_POOL_TASK,
+    SCHED_POOL_TIMER,
+    SCHED_POOL_CYCLE,
+    SCHED_POOL_SLOT,
+    SCHED_POOL_CALLBACK,
+    SCHED_POOL_COUNT
+} SchedPool_t;
+
+typedef struct {
+    u16 capacity;
+    u16 used;
+    u16 highWater; // most entries ever in use at the same time
+    u32 overflows; // allocations refused because the pool was full
+} SchedPoolStats_t;
+
+// Timer and cycle handle, carries a generation so a stale handle never cancels
+// an entry that was reused in the meantime.
+typedef u32 SchedTimer_t;
+#define SCHED_NONE 0
+
+// Ready tasks run earliest deadline first. A deadline is relative to the release
+// time (timer expiry or cycle period start), tasks without one are due
+// SCHED_BACKGROUND_SLACK after release.
+#define SCHED_NO_DEADLINE 0
+#define SCHED_BACKGROUND_SLACK TICK_PER_SECOND
+#define SCHED_CRITICAL 0x01 // a miss withholds the watchdog feed, see schedCriticalOk
+
+// Priority levels, the dispatcher always takes the highest non-empty level and runs
+// EDF inside it. Running tasks are never interrupted, a higher level only wins at the
+// next dispatch. The deadline variants take SCHED_PRIO(level) in their flags, no
+// level there means SCHED_PRIO_BACKGROUND.
+#define SCHED_PRIORITIES 4
+#define SCHED_PRIO_BACKGROUND 0
+#define SCHED_PRIO_NORMAL 1 // rendering and everything posted without a priority
+#define SCHED_PRIO_TIMING 2
+#define SCHED_PRIO_INPUT 3
+#define SCHED_PRIO(level) ((level) << 4)
+
+typedef struct {
+    TaskMng task;
+    u32 runs;
+    u32 misses;
+    Time_t worstLateness; // ticks past the deadline at completion
+} SchedDeadlineStats_t;
+
+// Emitted with the ticks late as n and the task as p when a task finishes after its deadline.
+extern const void* SchedDeadlineMissEvent;
+
+// Emitted with the SchedPool_t as n after an allocation was refused. Slots connected
+// to it are called directly from the overflow task, they never need a pool entry.
+extern const void* SchedOverflowEvent;
+
+void initSched(); // after initFemtOS
+
+// All calls are safe from both cores and from interrupt handlers.
+bool_t schedTask(TaskMng task, BaseSize_t n, BaseParam_t p);
+bool_t schedTaskPrio(TaskMng task, BaseSize_t n, BaseParam_t p, u08 priority);
+SchedTimer_t schedTimer(TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay);
+SchedTimer_t schedTimerPrio(TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay, u08 priority);
+SchedTimer_t schedTimerDeadline(TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay, Time_t deadline, u08 flags);
+SchedTimer_t schedCycle(Time_t period, CycleFuncPtr func);
+SchedTimer_t schedCycleDeadline(Time_t period, CycleFuncPtr func, Time_t deadline, u08 flags);
+// Timers and cycles, clears the handle. Cycle instances released but still queued
+// are dropped as well, only one already running on the other core can finish.
+bool_t schedCancel(SchedTimer_t* timer);
+// Moves a pending timer to a new delay, or creates it when it already fired.
+bool_t schedRestart(SchedTimer_t* timer, TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay);
+
+// Payload tasks: up to SCHED_PAYLOAD_SIZE bytes are copied into the task entry, the
+// handler gets the size as n and a pointer to its own copy as p, valid until it
+// returns. Nothing has to outlive the call that posts it.
+bool_t schedTaskPayload(TaskMng task, const void* payload, u08 size, u08 priority);
+void schedEmitPayload(const void* signal, const void* payload, u08 size, u08 priority);
+// Typed forms, the payload is a compound literal and its size is checked at compile time:
+// SCHED_POST(task, SCHED_PRIO_NORMAL, Point_t, .x = 1, .y = 2)
+#define SCHED_PAYLOAD_OF(type, ...) \
+    &(type){__VA_ARGS__}, sizeof(char[sizeof(type) <= SCHED_PAYLOAD_SIZE ? sizeof(type) : -1])
+#define SCHED_POST(task, priority, type, ...) \
+    schedTaskPayload((TaskMng)(task), SCHED_PAYLOAD_OF(type, __VA_ARGS__), priority)
+#define SCHED_EMIT(signal, priority, type, ...) \
+    schedEmitPayload(signal, SCHED_PAYLOAD_OF(type, __VA_ARGS__), priority)
+
+bool_t schedConnect(TaskMng task, const void* signal);
+void schedDisconnect(TaskMng task, const void* signal);
+void schedEmit(const void* signal, BaseSize_t n, BaseParam_t p);
+void schedEmitPrio(const void* signal, BaseSize_t n, BaseParam_t p, u08 priority);
+
+// One shot callbacks, schedExecCallBack queues and forgets everything registered for key.
+bool_t schedCallBack(TaskMng task, BaseSize_t n, BaseParam_t p, const void* key);
+void schedExecCallBack(const void* key);
+
+void schedPoolStats(SchedPool_t pool, SchedPoolStats_t* stats);
+bool_t schedDeadlineStats(TaskMng task, SchedDeadlineStats_t* stats); // FALSE if the task is not tracked
+// TRUE when no critical task missed its deadline since the previous call and none
+// is overdue right now. Feed the watchdog only then.
+bool_t schedCriticalOk();
+
+#endif /*SCHED_H_*/
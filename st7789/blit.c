@@ -0,0 +1,293 @@
+#include "blit.h"
+
+#include <pico/platform.h>
+
+#if PICO_ON_DEVICE
+#include "hardware/interp.h"
+#include "hardware/sync.h"
+#include "hardware/structs/systick.h"
+#endif
+
+#define BLIT_LINE 240 // pixels per line buffer, a multiple of 8
+
+void blit_glyph_ref(u16* dst, const u16* rows, u08 width, u08 height, u16 color, u16 bgcolor) {
+    for(u08 y = 0; y < height; y++) {
+        u16 bits = rows[y];
+        for(u08 x = 0; x < width; x++, bits <<= 1) {
+            *dst++ = (bits & 0x8000) ? color : bgcolor;
+        }
+    }
+}
+
+void blit_glyph4_ref(u16* dst, const u08* src, u08 width, u08 height, const u16* table) {
+    for(u08 y = 0; y < height; y++) {
+        for(u08 x = 0; x < width; x += 2) {
+            u08 pair = *src++;
+            dst[x] = table[pair >> 4];
+            dst[x + 1] = table[pair & 0x0F];
+        }
+        dst += width;
+    }
+}
+
+void blit_lut8_ref(u16* dst, const u08* src, u32 count, const u16* palette) {
+    while(count--) *dst++ = palette[*src++];
+}
+
+void blit_scale_ref(u16* dst, u32 count, const u16* src, u32 u, u32 step) {
+    for(; count--; u += step) *dst++ = src[u >> 16];
+}
+
+#if PICO_ON_DEVICE
+
+// Four pixels for every nibble of glyph bits, rebuilt when the colors change.
+// The interpolators are per core, so is the table.
+struct glyph_table {
+    u16 color;
+    u16 bgcolor;
+    bool_t valid;
+    u16 px[16][4];
+};
+static struct glyph_table glyph_tables[2];
+
+static const u16* ST7789_HOT(glyph_table)(u16 color, u16 bgcolor) {
+    struct glyph_table* t = &glyph_tables[get_core_num()];
+    if(!t->valid || t->color != color || t->bgcolor != bgcolor) {
+        for(u08 n = 0; n < 16; n++) {
+            for(u08 i = 0; i < 4; i++) t->px[n][i] = (n & (8 >> i)) ? color : bgcolor;
+        }
+        t->color = color;
+        t->bgcolor = bgcolor;
+        t->valid = TRUE;
+    }
+    return &t->px[0][0];
+}
+
+static inline void copy4(u16* dst, const u16* src) {
+    dst[0] = src[0];
+    dst[1] = src[1];
+    dst[2] = src[2];
+    dst[3] = src[3];
+}
+
+// accum0 holds the row shifted left by 3, lane0 picks nibble*8 of bits 15..12
+// (or 7..4 after another <<8), lane1 reads accum0 too and picks the next nibble.
+void ST7789_HOT(blit_glyph)(u16* dst, const u16* rows, u08 width, u08 height, u16 color, u16 bgcolor) {
+    const u16* table = glyph_table(color, bgcolor);
+    interp_config c = interp_default_config();
+    interp_config_set_shift(&c, 12);
+    interp_config_set_mask(&c, 3, 6);
+    interp_set_config(interp0, 0, &c);
+    interp_config_set_shift(&c, 8);
+    interp_config_set_cross_input(&c, true);
+    interp_set_config(interp0, 1, &c);
+    interp0->base[0] = (u32)(uintptr_t)table;
+    interp0->base[1] = (u32)(uintptr_t)table;
+    for(u08 y = 0; y < height; y++, dst += width) {
+        u32 bits = rows[y];
+        interp0->accum[0] = bits << 3;
+        copy4(dst, (const u16*)interp0->peek[0]);
+        copy4(dst + 4, (const u16*)interp0->peek[1]);
+        if(width <= 8) continue;
+        interp0->accum[0] = bits << 11;
+        copy4(dst + 8, (const u16*)interp0->peek[0]);
+        copy4(dst + 12, (const u16*)interp0->peek[1]);
+    }
+}
+
+// One byte per accum0 write, shifted left once: lane0 picks the high nibble*2
+// and lane1, reading accum0 as well, the low one.
+void ST7789_HOT(blit_glyph4)(u16* dst, const u08* src, u08 width, u08 height, const u16* table) {
+    interp_config c = interp_default_config();
+    interp_config_set_shift(&c, 4);
+    interp_config_set_mask(&c, 1, 4);
+    interp_set_config(interp0, 0, &c);
+    interp_config_set_shift(&c, 0);
+    interp_config_set_cross_input(&c, true);
+    interp_set_config(interp0, 1, &c);
+    interp0->base[0] = (u32)(uintptr_t)table;
+    interp0->base[1] = (u32)(uintptr_t)table;
+    for(u08 y = 0; y < height; y++, dst += width) {
+        u16* p = dst;
+        for(u08 x = 0; x < width; x += 2) {
+            interp0->accum[0] = (u32)*src++ << 1;
+            *p++ = *(const u16*)interp0->peek[0];
+            *p++ = *(const u16*)interp0->peek[1];
+        }
+    }
+}
+
+// Two indices per accum0 write, shifted left once so both lanes yield index*2.
+void ST7789_HOT(blit_lut8)(u16* dst, const u08* src, u32 count, const u16* palette) {
+    interp_config c = interp_default_config();
+    interp_config_set_shift(&c, 0);
+    interp_config_set_mask(&c, 1, 8);
+    interp_set_config(interp0, 0, &c);
+    interp_config_set_shift(&c, 8);
+    interp_config_set_cross_input(&c, true);
+    interp_set_config(interp0, 1, &c);
+    interp0->base[0] = (u32)(uintptr_t)palette;
+    interp0->base[1] = (u32)(uintptr_t)palette;
+    for(; count >= 2; count -= 2, src += 2) {
+        interp0->accum[0] = ((u32)src[0] | (u32)src[1] << 8) << 1;
+        *dst++ = *(const u16*)interp0->peek[0];
+        *dst++ = *(const u16*)interp0->peek[1];
+    }
+    if(count) *dst = palette[*src];
+}
+
+// Texture walk as in the pico-examples interp texture demo: lane0 adds step to u
+// on every pop (ADD_RAW) while the full result is src + (u >> 16) * 2.
+void ST7789_HOT(blit_scale)(u16* dst, u32 count, const u16* src, u32 u, u32 step) {
+    interp_config c = interp_default_config();
+    interp_config_set_add_raw(&c, true);
+    interp_config_set_shift(&c, 15);
+    interp_config_set_mask(&c, 1, 15);
+    interp_set_config(interp0, 0, &c);
+    c = interp_default_config();
+    interp_set_config(interp0, 1, &c);
+    interp0->accum[0] = u;
+    interp0->base[0] = step;
+    interp0->accum[1] = 0;
+    interp0->base[1] = 0;
+    interp0->base[2] = (u32)(uintptr_t)src;
+    while(count--) *dst++ = *(const u16*)interp0->pop[2];
+}
+
+#else
+
+void blit_glyph(u16* dst, const u16* rows, u08 width, u08 height, u16 color, u16 bgcolor) {
+    blit_glyph_ref(dst, rows, width, height, color, bgcolor);
+}
+
+void blit_glyph4(u16* dst, const u08* src, u08 width, u08 height, const u16* table) {
+    blit_glyph4_ref(dst, src, width, height, table);
+}
+
+void blit_lut8(u16* dst, const u08* src, u32 count, const u16* palette) {
+    blit_lut8_ref(dst, src, count, palette);
+}
+
+void blit_scale(u16* dst, u32 count, const u16* src, u32 u, u32 step) {
+    blit_scale_ref(dst, count, src, u, step);
+}
+
+#endif
+
+void ST7789_HOT(st7789_blit_lut8)(struct st7789* lcd, u16 x, u16 y, u16 w, u16 h, const u08* src, const u16* palette) {
+    u16 line[BLIT_LINE];
+    st7789_select_window(lcd, x, y, x + w - 1, y + h - 1);
+    for(u32 left = (u32)w * h; left;) {
+        u32 chunk = left < BLIT_LINE ? left : BLIT_LINE;
+        blit_lut8(line, src, chunk, palette);
+        st7789_write_pixels(lcd, line, chunk);
+        src += chunk;
+        left -= chunk;
+    }
+}
+
+void ST7789_HOT(st7789_blit_scaled)(struct st7789* lcd, u16 x, u16 y, u16 w, u16 h, const u16* src, u16 src_w, u16 src_h) {
+    u16 line[BLIT_LINE];
+    u32 step_x = ((u32)src_w << 16) / w;
+    u32 step_y = ((u32)src_h << 16) / h;
+    u32 prev_row = 0xFFFFFFFF;
+    st7789_select_window(lcd, x, y, x + w - 1, y + h - 1);
+    for(u32 v = 0; h--; v += step_y) {
+        u32 row = v >> 16;
+        if(w <= BLIT_LINE) {
+            if(row != prev_row) blit_scale(line, w, src + row * src_w, 0, step_x);
+            prev_row = row;
+            st7789_write_pixels(lcd, line, w);
+            continue;
+        }
+        for(u32 col = 0; col < w; col += BLIT_LINE) {
+            u32 chunk = w - col < BLIT_LINE ? w - col : BLIT_LINE;
+            blit_scale(line, chunk, src + row * src_w, col * step_x, step_x);
+            st7789_write_pixels(lcd, line, chunk);
+        }
+    }
+}
+
+#if PICO_ON_DEVICE
+
+#define BENCH_PIXELS 192 // 12 rows of a 16 pixel glyph
+
+static u32 bench_start() {
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5; // enabled, counting clk_sys
+    return systick_hw->cvr;
+}
+
+static u32 bench_cycles(u32 start) {
+    return (start - systick_hw->cvr) & 0x00FFFFFF;
+}
+
+static u32 bench_mismatches(const u16* a, const u16* b, u32 count) {
+    u32 n = 0;
+    while(count--) n += *a++ != *b++;
+    return n;
+}
+
+void blit_benchmark(struct blit_bench* result) {
+    static u16 ref[BENCH_PIXELS + 16];
+    static u16 fast[BENCH_PIXELS + 16];
+    static u16 palette[256];
+    static u08 indices[BENCH_PIXELS];
+    static u16 rows[BENCH_PIXELS / 16];
+    u32 seed = 0x2545F491;
+    for(u16 i = 0; i < 256; i++) palette[i] = (u16)(i * 0x0821 + 0x1234);
+    for(u16 i = 0; i < BENCH_PIXELS; i++) {
+        seed = seed * 1664525 + 1013904223;
+        indices[i] = seed >> 24;
+        ref[i] = seed >> 16; // source image for the scale kernel
+    }
+    for(u08 i = 0; i < BENCH_PIXELS / 16; i++) rows[i] = (u16)(0x9F3A * (i + 1));
+
+    u32 irq = save_and_disable_interrupts();
+    u32 t;
+    // scale first, it reads ref as its source and writes only fast
+    static u16 scaled[BENCH_PIXELS];
+    t = bench_start();
+    blit_scale_ref(scaled, BENCH_PIXELS, ref, 0x8000, 0xC000);
+    result->ref_cycles[BLIT_KERNEL_SCALE] = bench_cycles(t);
+    t = bench_start();
+    blit_scale(fast, BENCH_PIXELS, ref, 0x8000, 0xC000);
+    result->interp_cycles[BLIT_KERNEL_SCALE] = bench_cycles(t);
+    result->mismatches[BLIT_KERNEL_SCALE] = bench_mismatches(scaled, fast, BENCH_PIXELS);
+
+    t = bench_start();
+    blit_lut8_ref(ref, indices, BENCH_PIXELS, palette);
+    result->ref_cycles[BLIT_KERNEL_LUT8] = bench_cycles(t);
+    t = bench_start();
+    blit_lut8(fast, indices, BENCH_PIXELS, palette);
+    result->interp_cycles[BLIT_KERNEL_LUT8] = bench_cycles(t);
+    result->mismatches[BLIT_KERNEL_LUT8] = bench_mismatches(ref, fast, BENCH_PIXELS);
+
+    glyph_table(ST_COLOR_WHITE, ST_COLOR_BLACK); // table build is a once per color pair cost
+    t = bench_start();
+    blit_glyph_ref(ref, rows, 16, BENCH_PIXELS / 16, ST_COLOR_WHITE, ST_COLOR_BLACK);
+    result->ref_cycles[BLIT_KERNEL_GLYPH] = bench_cycles(t);
+    t = bench_start();
+    blit_glyph(fast, rows, 16, BENCH_PIXELS / 16, ST_COLOR_WHITE, ST_COLOR_BLACK);
+    result->interp_cycles[BLIT_KERNEL_GLYPH] = bench_cycles(t);
+    result->mismatches[BLIT_KERNEL_GLYPH] = bench_mismatches(ref, fast, BENCH_PIXELS);
+
+    static u16 levels[16];
+    for(u08 i = 0; i < 16; i++) levels[i] = palette[i * 17];
+    t = bench_start();
+    blit_glyph4_ref(ref, indices, 16, BENCH_PIXELS / 16, levels);
+    result->ref_cycles[BLIT_KERNEL_GLYPH4] = bench_cycles(t);
+    t = bench_start();
+    blit_glyph4(fast, indices, 16, BENCH_PIXELS / 16, levels);
+    result->interp_cycles[BLIT_KERNEL_GLYPH4] = bench_cycles(t);
+    result->mismatches[BLIT_KERNEL_GLYPH4] = bench_mismatches(ref, fast, BENCH_PIXELS);
+    restore_interrupts(irq);
+
+    for(u08 k = 0; k < BLIT_KERNEL_COUNT; k++) {
+        result->ref_cycles[k] = result->ref_cycles[k] * 100 / BENCH_PIXELS;
+        result->interp_cycles[k] = result->interp_cycles[k] * 100 / BENCH_PIXELS;
+    }
+}
+
+#endif
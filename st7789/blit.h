@@ -0,0 +1,56 @@
+#ifndef _PICO_ST7789_BLIT_H_
+#define _PICO_ST7789_BLIT_H_
+
+#include "hardware/spi.h"
+
+#include "st7789.h"
+
+// Row kernels producing RGB565 for st7789_write_pixels. On the device they use
+// interp0 of the calling core for the table and address generation, so they must
+// not be called from interrupt handlers. The *_ref versions are the plain C loops,
+// they build on any host and are the reference the fast kernels are checked against.
+
+// Expands `height` font rows (MSB first u16, like FontDef data) of `width` <= 16
+// pixels to color/bgcolor. dst needs 16 - width spare pixels past the glyph.
+void blit_glyph(u16* dst, const u16* rows, u08 width, u08 height, u16 color, u16 bgcolor);
+void blit_glyph_ref(u16* dst, const u16* rows, u08 width, u08 height, u16 color, u16 bgcolor);
+
+// Expands `height` rows of 4 bit coverage (FontDef aa data) of `width` pixels
+// through a 16 entry table. dst needs one spare pixel past the glyph.
+void blit_glyph4(u16* dst, const u08* src, u08 width, u08 height, const u16* table);
+void blit_glyph4_ref(u16* dst, const u08* src, u08 width, u08 height, const u16* table);
+
+// 8-bit indexed pixels through a 256 entry RGB565 palette.
+void blit_lut8(u16* dst, const u08* src, u32 count, const u16* palette);
+void blit_lut8_ref(u16* dst, const u08* src, u32 count, const u16* palette);
+
+// Nearest neighbor resampling, dst[i] = src[(u + i * step) >> 16] with 16.16 u and step.
+// Source rows are limited to 32768 pixels.
+void blit_scale(u16* dst, u32 count, const u16* src, u32 u, u32 step);
+void blit_scale_ref(u16* dst, u32 count, const u16* src, u32 u, u32 step);
+
+// Window blits, rows are expanded into a line buffer and sent in one burst each.
+void st7789_blit_lut8(struct st7789* lcd, u16 x, u16 y, u16 w, u16 h, const u08* src, const u16* palette);
+// Scales a src_w x src_h RGB565 image to w x h, destination rows that map to the
+// same source row are sent again from the line buffer without resampling.
+void st7789_blit_scaled(struct st7789* lcd, u16 x, u16 y, u16 w, u16 h, const u16* src, u16 src_w, u16 src_h);
+
+typedef enum {
+    BLIT_KERNEL_GLYPH,
+    BLIT_KERNEL_GLYPH4,
+    BLIT_KERNEL_LUT8,
+    BLIT_KERNEL_SCALE,
+    BLIT_KERNEL_COUNT
+} BlitKernel_t;
+
+struct blit_bench {
+    u32 ref_cycles[BLIT_KERNEL_COUNT];    // cycles per pixel x100, plain loops
+    u32 interp_cycles[BLIT_KERNEL_COUNT]; // cycles per pixel x100, interpolator kernels
+    u32 mismatches[BLIT_KERNEL_COUNT];    // pixels where the two disagree
+};
+
+// Runs every kernel on the same generated input with interrupts off and times it
+// with SysTick on clk_sys. Device only, takes a few ms.
+void blit_benchmark(struct blit_bench* result);
+
+#endif
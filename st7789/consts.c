@@ -19,6 +19,8 @@
 #define ST7789_RAMRD   		0x2E
 
 #define ST7789_PTLAR   		0x30
+#define ST7789_IDMOFF  		0x38 /*IDLE MODE OFF*/
+#define ST7789_IDMON   		0x39 /*IDLE MODE ON*/
 #define ST7789_COLMOD  		0x3A
 #define ST7789_MADCTL  		0x36
 #define ST7789_VSCSAD       0x37
@@ -0,0 +1,296 @@
+#include "dlist.h"
+
+#include <string.h>
+
+#include <pico/platform.h>
+#include "hardware/gpio.h"
+
+#if PICO_ON_DEVICE
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "st7789_dlist.pio.h"
+#endif
+
+#include "consts.c"
+
+#define DLIST_DATA 0x8000         // header D/C bit
+#define DLIST_READ_INCR (1u << 4) // INCR_READ of the DMA CTRL register, survives patching
+
+static struct {
+    struct st7789* lcd;
+    PIO pio;
+    u08 sm;
+    s08 data;  // channel feeding the PIO, -1 until attached
+    s08 ctrl;  // channel loading the control blocks into data
+    const struct st7789_dlist_block* end; // ctrl read address once the chain is done
+} transport = {.data = -1};
+
+static bool_t st7789_dlist_room(struct st7789_dlist* list, u32 halfwords, u08 blocks) {
+    // one block slot always stays free for the end of the chain
+    if(list->overflow || list->len + halfwords > list->capacity || list->block_count + blocks >= list->block_capacity) {
+        list->overflow = true;
+        return false;
+    }
+    return true;
+}
+
+static void st7789_dlist_block(struct st7789_dlist* list, const u16* read, u32 count, bool_t incr) {
+    struct st7789_dlist_block* b = &list->blocks[list->block_count++];
+    b->ctrl = incr ? DLIST_READ_INCR : 0;
+    b->read = read;
+    b->write = NULL;
+    b->count = count;
+    list->patched = -1;
+}
+
+// Everything recorded since the last block is contiguous and goes out in one block.
+static void st7789_dlist_close(struct st7789_dlist* list) {
+    if(list->open == list->len) return;
+    st7789_dlist_block(list, &list->buf[list->open], list->len - list->open, true);
+    list->open = list->len;
+}
+
+void st7789_dlist_begin(struct st7789_dlist* list, u16* buf, u16 capacity, struct st7789_dlist_block* blocks, u08 block_capacity) {
+    list->buf = buf;
+    list->capacity = capacity;
+    list->len = 0;
+    list->open = 0;
+    list->blocks = blocks;
+    list->block_capacity = block_capacity;
+    list->block_count = 0;
+    list->overflow = false;
+    list->patched = -1;
+    list->tx_bytes = 0;
+    list->tx_cmds = 0;
+    list->tx_pixels = 0;
+}
+
+void st7789_dlist_window(struct st7789_dlist* list, u16 x0, u16 y0, u16 x1, u16 y1) {
+    if(!st7789_dlist_room(list, ST7789_DLIST_WINDOW, 0)) return;
+    u16* p = &list->buf[list->len];
+    *p++ = 0;              // command, one halfword
+    *p++ = ST7789_CASET;   // sent as NOP, CASET
+    *p++ = DLIST_DATA | 1; // two halfwords of parameters
+    *p++ = x0;
+    *p++ = x1;
+    *p++ = 0;
+    *p++ = ST7789_RASET;
+    *p++ = DLIST_DATA | 1;
+    *p++ = y0;
+    *p++ = y1;
+    *p++ = 0;
+    *p++ = ST7789_RAMWR;
+    list->len += ST7789_DLIST_WINDOW;
+    list->tx_bytes += 2 * 7; // three commands and four parameters, the five headers stay in the PIO
+    list->tx_cmds += 3;
+}
+
+void st7789_dlist_pixels(struct st7789_dlist* list, const u16* pixels, u32 count) {
+    while(count) {
+        u32 n = count < ST7789_DLIST_ENTRY_MAX ? count : ST7789_DLIST_ENTRY_MAX;
+        if(!st7789_dlist_room(list, n + 1, 0)) return;
+        list->buf[list->len++] = DLIST_DATA | (n - 1);
+        memcpy(&list->buf[list->len], pixels, n * 2);
+        list->len += n;
+        list->tx_bytes += n * 2;
+        list->tx_pixels += n;
+        pixels += n;
+        count -= n;
+    }
+}
+
+void st7789_dlist_fill(struct st7789_dlist* list, u16 pixel, u32 count) {
+    while(count) {
+        u32 n = count < ST7789_DLIST_ENTRY_MAX ? count : ST7789_DLIST_ENTRY_MAX;
+        if(!st7789_dlist_room(list, 2, 2)) return;
+        list->buf[list->len++] = DLIST_DATA | (n - 1);
+        st7789_dlist_close(list);
+        // the color is read n times without increment
+        st7789_dlist_block(list, &list->buf[list->len], n, false);
+        list->buf[list->len++] = pixel;
+        list->open = list->len;
+        list->tx_bytes += n * 2;
+        list->tx_pixels += n;
+        count -= n;
+    }
+}
+
+void st7789_dlist_rect(struct st7789_dlist* list, u16 x, u16 y, u16 w, u16 h, u16 color) {
+    if(!w || !h) return;
+    st7789_dlist_window(list, x, y, x + w - 1, y + h - 1);
+    st7789_dlist_fill(list, color, (u32)w * h);
+}
+
+bool_t st7789_dlist_end(struct st7789_dlist* list) {
+    if(!st7789_dlist_room(list, 0, list->open != list->len)) return false;
+    st7789_dlist_close(list);
+    memset(&list->blocks[list->block_count], 0, sizeof(struct st7789_dlist_block)); // null trigger
+    return true;
+}
+
+// Same list through the SPI functions, for panels without a transport.
+static void st7789_dlist_walk(struct st7789* lcd, const struct st7789_dlist* list) {
+    u16 x0 = 0, y0 = 0, x1 = 0, y1 = 0;
+    u08 cmd = ST7789_NOP;
+    u08 param = 0;
+    bool_t data = false;
+    u32 left = 0; // halfwords left in the current entry
+    for(u08 b = 0; b < list->block_count; b++) {
+        const u16* p = (const u16*)list->blocks[b].read;
+        u32 n = list->blocks[b].count;
+        if(!(list->blocks[b].ctrl & DLIST_READ_INCR)) {
+            st7789_write_repeat(lcd, *p, n);
+            left -= n;
+            continue;
+        }
+        while(n) {
+            if(!left) {
+                data = (*p & DLIST_DATA) != 0;
+                left = (*p & ~DLIST_DATA) + 1;
+                param = 0;
+                p++;
+                n--;
+                continue;
+            }
+            if(!data) {
+                cmd = *p & 0xFF;
+                if(cmd == ST7789_RAMWR) st7789_select_window(lcd, x0, y0, x1, y1);
+                p++;
+                n--;
+                left--;
+                continue;
+            }
+            if(cmd == ST7789_RAMWR) {
+                u32 k = n < left ? n : left;
+                st7789_write_pixels(lcd, p, k);
+                p += k;
+                n -= k;
+                left -= k;
+                continue;
+            }
+            if(cmd == ST7789_CASET) *(param ? &x1 : &x0) = *p;
+            if(cmd == ST7789_RASET) *(param ? &y1 : &y0) = *p;
+            param++;
+            p++;
+            n--;
+            left--;
+        }
+    }
+}
+
+#if PICO_ON_DEVICE
+
+bool_t st7789_dlist_attach(struct st7789* lcd, PIO pio) {
+    if(transport.data >= 0) return transport.lcd == lcd;
+    if(!pio_can_add_program(pio, &st7789_dlist_program)) return false;
+    int sm = pio_claim_unused_sm(pio, false);
+    if(sm < 0) return false;
+    int data = dma_claim_unused_channel(false);
+    int ctrl = data < 0 ? -1 : dma_claim_unused_channel(false);
+    if(ctrl < 0) {
+        if(data >= 0) dma_channel_unclaim(data);
+        pio_sm_unclaim(pio, sm);
+        return false;
+    }
+
+    uint offset = pio_add_program(pio, &st7789_dlist_program);
+    pio_sm_config c = st7789_dlist_program_get_default_config(offset);
+    sm_config_set_out_pins(&c, lcd->cfg.gpio_din, 1);
+    sm_config_set_set_pins(&c, lcd->cfg.gpio_dc, 1);
+    sm_config_set_sideset_pins(&c, lcd->cfg.gpio_clk);
+    sm_config_set_out_shift(&c, false, false, 32);
+    sm_config_set_fifo_join(&c, PIO_FIFO_JOIN_TX);
+    pio_sm_init(pio, sm, offset, &c);
+    u32 pins = 1u << lcd->cfg.gpio_din | 1u << lcd->cfg.gpio_clk | 1u << lcd->cfg.gpio_dc;
+    pio_sm_set_consecutive_pindirs(pio, sm, lcd->cfg.gpio_din, 1, true);
+    pio_sm_set_consecutive_pindirs(pio, sm, lcd->cfg.gpio_clk, 1, true);
+    pio_sm_set_consecutive_pindirs(pio, sm, lcd->cfg.gpio_dc, 1, true);
+    pio_sm_set_pins_with_mask(pio, sm, 1u << lcd->cfg.gpio_clk, pins); // mode 3 clock idles high
+    pio_sm_set_enabled(pio, sm, true);
+
+    // ctrl copies one block into the al1 registers of data, the last write triggers it,
+    // and data chains back to ctrl when done
+    dma_channel_config cc = dma_channel_get_default_config(ctrl);
+    channel_config_set_transfer_data_size(&cc, DMA_SIZE_32);
+    channel_config_set_read_increment(&cc, true);
+    channel_config_set_write_increment(&cc, true);
+    channel_config_set_ring(&cc, true, 4);
+    dma_channel_configure(ctrl, &cc, &dma_hw->ch[data].al1_ctrl, NULL, 4, false);
+
+    transport.lcd = lcd;
+    transport.pio = pio;
+    transport.sm = sm;
+    transport.data = data;
+    transport.ctrl = ctrl;
+    return true;
+}
+
+static void st7789_dlist_patch(struct st7789_dlist* list) {
+    if(list->patched == transport.data) return;
+    for(u08 i = 0; i < list->block_count; i++) {
+        dma_channel_config c = dma_channel_get_default_config(transport.data);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+        channel_config_set_read_increment(&c, (list->blocks[i].ctrl & DLIST_READ_INCR) != 0);
+        channel_config_set_write_increment(&c, false);
+        channel_config_set_dreq(&c, pio_get_dreq(transport.pio, transport.sm, true));
+        channel_config_set_chain_to(&c, transport.ctrl);
+        channel_config_set_irq_quiet(&c, true);
+        list->blocks[i].ctrl = channel_config_get_ctrl_value(&c);
+        list->blocks[i].write = &transport.pio->txf[transport.sm];
+    }
+    list->patched = transport.data;
+}
+
+void st7789_dlist_replay(struct st7789* lcd, struct st7789_dlist* list) {
+    if(list->overflow) return;
+    if(transport.lcd != lcd || lcd->cfg.pixel_format != ST7789_FORMAT_RGB565 || lcd->mirrored) {
+        st7789_dlist_walk(lcd, list);
+        return;
+    }
+    st7789_wait_idle(lcd); // also finishes an earlier replay
+    st7789_dlist_patch(list);
+    // two PIO cycles per bit, same bit rate as the SPI block
+    float div = (float)clock_get_hz(clk_sys) / (2.0f * spi_get_baudrate(lcd->cfg.spi));
+    pio_sm_set_clkdiv(transport.pio, transport.sm, div < 1.0f ? 1.0f : div);
+    pio_gpio_init(transport.pio, lcd->cfg.gpio_din);
+    pio_gpio_init(transport.pio, lcd->cfg.gpio_clk);
+    pio_gpio_init(transport.pio, lcd->cfg.gpio_dc);
+    lcd->data_mode = false;
+    lcd->dlist_busy = true;
+    lcd->tx_bytes += list->tx_bytes;
+    lcd->tx_cmds += list->tx_cmds;
+    lcd->tx_pixels += list->tx_pixels;
+    transport.end = &list->blocks[list->block_count + 1];
+    dma_channel_set_read_addr(transport.ctrl, list->blocks, true);
+}
+
+void st7789_dlist_wait(struct st7789* lcd) {
+    if(!lcd->dlist_busy) return;
+    while(dma_hw->ch[transport.ctrl].read_addr != (u32)transport.end ||
+          dma_channel_is_busy(transport.ctrl) || dma_channel_is_busy(transport.data)) {
+        tight_loop_contents();
+    }
+    // the FIFO may still hold the tail, the SM stalls on its pull once all bits are out
+    u32 stall = 1u << (PIO_FDEBUG_TXSTALL_LSB + transport.sm);
+    transport.pio->fdebug = stall;
+    while(!(transport.pio->fdebug & stall)) tight_loop_contents();
+    gpio_set_function(lcd->cfg.gpio_din, GPIO_FUNC_SPI);
+    gpio_set_function(lcd->cfg.gpio_clk, GPIO_FUNC_SPI);
+    gpio_set_function(lcd->cfg.gpio_dc, GPIO_FUNC_SIO);
+    lcd->dlist_busy = false;
+}
+
+#else
+
+bool_t st7789_dlist_attach(struct st7789* lcd, PIO pio) {
+    return false;
+}
+
+void st7789_dlist_replay(struct st7789* lcd, struct st7789_dlist* list) {
+    if(!list->overflow) st7789_dlist_walk(lcd, list);
+}
+
+void st7789_dlist_wait(struct st7789* lcd) {
+}
+
+#endif
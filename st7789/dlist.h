@@ -0,0 +1,60 @@
+#ifndef _PICO_ST7789_DLIST_H_
+#define _PICO_ST7789_DLIST_H_
+
+#include "hardware/spi.h"
+#include "hardware/pio.h"
+
+#include "st7789.h"
+
+// Display lists: window, pixel burst and fill entries recorded once into caller
+// storage as the halfword stream of st7789_dlist.pio, together with the DMA control
+// blocks that send it. A replay is one DMA kick: a control channel loads the blocks
+// into a data channel feeding the PIO, which drives D/C itself. Fills are blocks
+// reading one halfword without increment, so they cost a header and a color.
+// RGB565 only. Without an attached transport, for RGB444 panels and while the panel
+// is mirrored, replay walks the list and uses the SPI functions instead.
+
+#define ST7789_DLIST_ENTRY_MAX 32768 // halfwords per header, longer bursts and fills are split
+#define ST7789_DLIST_WINDOW 12       // halfwords of a window entry, CASET, RASET and RAMWR
+
+// One DMA control block, in the order of the al1 register alias it is copied to.
+struct st7789_dlist_block {
+    u32 ctrl;
+    const volatile void* read;
+    volatile void* write;
+    u32 count; // 0 ends the chain
+};
+
+struct st7789_dlist {
+    u16* buf;
+    u16 capacity;
+    u16 len;
+    u16 open;    // first halfword not covered by a block yet
+    struct st7789_dlist_block* blocks;
+    u08 block_capacity; // needs one more than the blocks used, for the end of the chain
+    u08 block_count;
+    bool_t overflow;
+    s08 patched; // data channel the block control words were made for, -1 before that
+    // traffic per replay, headers are not sent
+    u32 tx_bytes;
+    u32 tx_cmds;
+    u32 tx_pixels;
+};
+
+// Claims a state machine on pio and two DMA channels for lcd, its SPI pins are
+// switched to the PIO for the duration of each replay.
+bool_t st7789_dlist_attach(struct st7789* lcd, PIO pio);
+
+void st7789_dlist_begin(struct st7789_dlist* list, u16* buf, u16 capacity, struct st7789_dlist_block* blocks, u08 block_capacity);
+void st7789_dlist_window(struct st7789_dlist* list, u16 x0, u16 y0, u16 x1, u16 y1);
+void st7789_dlist_pixels(struct st7789_dlist* list, const u16* pixels, u32 count); // copied into the list
+void st7789_dlist_fill(struct st7789_dlist* list, u16 pixel, u32 count);
+void st7789_dlist_rect(struct st7789_dlist* list, u16 x, u16 y, u16 w, u16 h, u16 color);
+bool_t st7789_dlist_end(struct st7789_dlist* list); // FALSE when the storage was too small
+
+// Starts the list and returns, the next driver call on lcd waits for it to finish.
+// A list can be replayed any number of times, its storage must stay untouched meanwhile.
+void st7789_dlist_replay(struct st7789* lcd, struct st7789_dlist* list);
+void st7789_dlist_wait(struct st7789* lcd); // returns the pins to the SPI block
+
+#endif
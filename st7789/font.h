@@ -3,15 +3,24 @@
 
 #include "../femtox/FemtoxTypes.h"
 
+// Anti-aliased fonts come from tools/fontgen.py and carry 4 bit coverage per pixel
+// in aa, two pixels per byte with the left one in the high nibble and every row
+// padded to whole bytes. They are drawn unscaled and have no 1 bpp data.
 typedef struct {
     const u08 width;
     u08 height;
     const u16 *data;
+    const u08 *aa;
 } FontDef;
 
 //Font lib.
 extern FontDef Font_7x10;
 extern FontDef Font_11x18;
+#ifdef ST7789_FONT_16X26 // ~5 KB of flash, st7789_write_string can scale the small fonts instead
 extern FontDef Font_16x26;
+#endif
+#ifdef ST7789_FONT_AA // ~37 KB of flash
+extern FontDef FontAA_22x36;
+#endif
 
 #endif /* INC_FONTS_H_ */
@@ -0,0 +1,3525 @@
+// Generated by tools/fontgen.py DejaVuSansMono-Bold.ttf 22 36 FontAA_22x36, do not edit.
+// DejaVu and Bitstream Vera fonts may be embedded, see their LICENSE.
+#include <stddef.h>
+
+#include "font.h"
+
+static const u08 FontAA22x36 [] = {
+// ' '
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '!'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x08, 0xCC, 0x90, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3C, 0xCC, 0xC3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3D, 0xDD, 0xD3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '"'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x12, 0x22, 0x20, 0x00, 0x02, 0x22, 0x21, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x13, 0x33, 0x20, 0x00, 0x02, 0x33, 0x31, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '#'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3B, 0xBB, 0x50, 0x02, 0xBB, 0xB6, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x30, 0x06, 0xFF, 0xF5, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x00, 0x0A, 0xFF, 0xF1, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x0E, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xF7, 0x00, 0x2F, 0xFF, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x6F, 0xFF, 0x40, 0x00,
+0x00, 0x27, 0x77, 0x7D, 0xFF, 0xF7, 0x77, 0xCF, 0xFF, 0x77, 0x72,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4,
+0x00, 0x12, 0x22, 0xDF, 0xFE, 0x22, 0x2B, 0xFF, 0xF2, 0x22, 0x20,
+0x00, 0x00, 0x01, 0xFF, 0xFA, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xF6, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00,
+0x00, 0x00, 0x08, 0xFF, 0xF2, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x0C, 0xFF, 0xE0, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00,
+0x4E, 0xEE, 0xEF, 0xFF, 0xFE, 0xEE, 0xFF, 0xFF, 0xEE, 0xE4, 0x00,
+0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+0x39, 0x99, 0xEF, 0xFE, 0x99, 0x9D, 0xFF, 0xF9, 0x99, 0x93, 0x00,
+0x00, 0x01, 0xFF, 0xFA, 0x00, 0x0E, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x04, 0xFF, 0xF6, 0x00, 0x2F, 0xFF, 0x80, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xF2, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xE0, 0x00, 0xAF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xA0, 0x00, 0xEF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x4D, 0xDD, 0x60, 0x02, 0xDD, 0xD7, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '$'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x71, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xEB, 0x82, 0x00, 0x00,
+0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xE9, 0xFF, 0xA9, 0xCF, 0xF7, 0x00, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0x31, 0xFF, 0x50, 0x02, 0x86, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFD, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFE, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x91, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFE, 0xFF, 0x82, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x48, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x68, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0xBF, 0xFF, 0xE0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x8F, 0xFF, 0xE0, 0x00,
+0x00, 0x06, 0x81, 0x00, 0x01, 0xFF, 0x50, 0x9F, 0xFF, 0xD0, 0x00,
+0x00, 0x07, 0xFE, 0x94, 0x11, 0xFF, 0x55, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x03, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x69, 0xCD, 0xFF, 0xEC, 0x82, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xEE, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '%'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xAF, 0xFF, 0xB3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x07, 0xFF, 0xE4, 0x03, 0xDF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x0B, 0xFF, 0x60, 0x00, 0x4F, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x0B, 0xFF, 0x40, 0x00, 0x2F, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x09, 0xFF, 0xA0, 0x00, 0x8F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x05, 0xFF, 0xFB, 0x7A, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x14, 0x00,
+0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x4A, 0xFE, 0x10,
+0x00, 0x1A, 0xFF, 0xFF, 0xFB, 0x10, 0x01, 0x7D, 0xFF, 0xC6, 0x10,
+0x00, 0x00, 0x38, 0x98, 0x40, 0x04, 0xAF, 0xFE, 0x93, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x17, 0xDF, 0xFC, 0x61, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4A, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x7D, 0xFF, 0xC6, 0x10, 0x05, 0xAC, 0xB8, 0x10, 0x00,
+0x00, 0x8F, 0xFE, 0x93, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xE4, 0x00,
+0x00, 0x8C, 0x61, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFE, 0x20,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x94, 0x6E, 0xFF, 0xA0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFB, 0x00, 0x04, 0xFF, 0xF0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x9F, 0xF7, 0x00, 0x00, 0xFF, 0xF1,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFA, 0x00, 0x03, 0xFF, 0xF0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x82, 0x5D, 0xFF, 0xB0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xBD, 0xD9, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '&'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x36, 0x88, 0x87, 0x41, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x64, 0x46, 0xAF, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xF3, 0x00, 0x00, 0x02, 0x10, 0x00, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3F, 0xFF, 0xFE, 0xEF, 0xFF, 0xF3, 0x00, 0x08, 0x88, 0x80,
+0x00, 0xBF, 0xFF, 0xE2, 0x6F, 0xFF, 0xFC, 0x00, 0x0C, 0xFF, 0xF0,
+0x03, 0xFF, 0xFF, 0x50, 0x0B, 0xFF, 0xFF, 0x80, 0x0C, 0xFF, 0xF0,
+0x07, 0xFF, 0xFE, 0x00, 0x02, 0xEF, 0xFF, 0xF3, 0x0D, 0xFF, 0xD0,
+0x0A, 0xFF, 0xFC, 0x00, 0x00, 0x7F, 0xFF, 0xFC, 0x2F, 0xFF, 0xB0,
+0x0A, 0xFF, 0xFD, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xDF, 0xFF, 0x70,
+0x0A, 0xFF, 0xFF, 0x30, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+0x07, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xF8, 0x00,
+0x03, 0xFF, 0xFF, 0xF9, 0x10, 0x00, 0x2E, 0xFF, 0xFF, 0xD1, 0x00,
+0x00, 0xBF, 0xFF, 0xFF, 0xEA, 0x9B, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+0x00, 0x02, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0x70,
+0x00, 0x00, 0x17, 0xDF, 0xFF, 0xFF, 0xE9, 0x23, 0xDD, 0xDD, 0xD1,
+0x00, 0x00, 0x00, 0x03, 0x56, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '''
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x13, 0x33, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '('
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x12, 0x22, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFC, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x57, 0x77, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// ')'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xCF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0C, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x05, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2F, 0xFF, 0xD1, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xAF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x77, 0x75, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '*'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0x88, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x03, 0x81, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x19, 0x30, 0x00,
+0x00, 0x0B, 0xFE, 0x71, 0x08, 0xFF, 0x60, 0x18, 0xEF, 0xA0, 0x00,
+0x00, 0x2D, 0xFF, 0xFD, 0x58, 0xFF, 0x66, 0xEF, 0xFF, 0xD1, 0x00,
+0x00, 0x01, 0x7E, 0xFF, 0xFE, 0xFF, 0xEF, 0xFF, 0xE6, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x7E, 0xFF, 0xFF, 0xFF, 0xE7, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x20, 0x00, 0x00,
+0x00, 0x02, 0x9F, 0xFF, 0xFD, 0xFF, 0xDF, 0xFF, 0xF9, 0x10, 0x00,
+0x00, 0x2F, 0xFF, 0xFB, 0x38, 0xFF, 0x63, 0xBF, 0xFF, 0xE1, 0x00,
+0x00, 0x0A, 0xFC, 0x40, 0x08, 0xFF, 0x60, 0x05, 0xDF, 0x90, 0x00,
+0x00, 0x02, 0x60, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x06, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '+'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x11, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x03, 0xDD, 0xDD, 0xDD, 0xDF, 0xFF, 0xFD, 0xDD, 0xDD, 0xDD, 0x20,
+0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+0x00, 0x22, 0x22, 0x22, 0x2F, 0xFF, 0xF2, 0x22, 0x22, 0x22, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x06, 0x66, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// ','
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x24, 0x44, 0x42, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0E, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2A, 0xAA, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '-'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x02, 0x77, 0x77, 0x77, 0x77, 0x77, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x02, 0x77, 0x77, 0x77, 0x77, 0x77, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '.'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x34, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBD, 0xDD, 0xDA, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '/'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x21, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xF2, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xA0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x30, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFB, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xC0, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFD, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xEF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x1E, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0C, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x4F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xBF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x03, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0A, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '0'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x37, 0x88, 0x73, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3C, 0xFF, 0xFF, 0xFF, 0xC3, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xF3, 0x00, 0x3F, 0xFF, 0xFF, 0x20, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x09, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x04, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF2, 0x00,
+0x00, 0x3F, 0xFF, 0xFB, 0x02, 0x99, 0x20, 0xBF, 0xFF, 0xF3, 0x00,
+0x00, 0x4F, 0xFF, 0xFB, 0x0D, 0xFF, 0xD0, 0xBF, 0xFF, 0xF4, 0x00,
+0x00, 0x4F, 0xFF, 0xFA, 0x1F, 0xFF, 0xF1, 0xAF, 0xFF, 0xF4, 0x00,
+0x00, 0x4F, 0xFF, 0xFB, 0x0C, 0xFF, 0xB0, 0xBF, 0xFF, 0xF4, 0x00,
+0x00, 0x3F, 0xFF, 0xFB, 0x01, 0x66, 0x10, 0xBF, 0xFF, 0xF3, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF2, 0x00,
+0x00, 0x0F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF0, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x0A, 0xFF, 0xFF, 0x50, 0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x01, 0xEF, 0xFF, 0xF6, 0x00, 0x6F, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00,
+0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x19, 0xFF, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x14, 0x66, 0x41, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '1'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x03, 0x6A, 0xEF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xCF, 0xFB, 0x8B, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x64, 0x10, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x77, 0x77, 0x7C, 0xFF, 0xFF, 0x87, 0x77, 0x75, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+0x00, 0x02, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD9, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '2'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x36, 0x78, 0x87, 0x51, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+0x00, 0x0D, 0xFF, 0xD9, 0x65, 0x6A, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+0x00, 0x0D, 0xA4, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x30, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x06, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x5F, 0xFF, 0xFD, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xD2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3F, 0xFF, 0xFF, 0x87, 0x77, 0x77, 0x77, 0x77, 0x30, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x5D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '3'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x36, 0x78, 0x88, 0x63, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x04, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD6, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFD, 0xB9, 0xAC, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
+0x00, 0x07, 0xA5, 0x10, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x07, 0x99, 0xAD, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFC, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0x91, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x08, 0xAA, 0xBE, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00,
+0x00, 0x12, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x4F, 0xB6, 0x30, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xDD, 0xDF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00,
+0x00, 0x16, 0xAE, 0xFF, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x24, 0x56, 0x65, 0x31, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '4'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xDF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x06, 0xFF, 0xF9, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x1E, 0xFF, 0xD1, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xAF, 0xFF, 0x50, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFA, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x1D, 0xFF, 0xE1, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0x60, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x03, 0xFF, 0xFB, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xF2, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x7F, 0xFF, 0x70, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x9F, 0xFF, 0xBB, 0xBB, 0xBB, 0xEF, 0xFF, 0xFB, 0xB9, 0x00,
+0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+0x00, 0x58, 0x88, 0x88, 0x88, 0x88, 0xDF, 0xFF, 0xF8, 0x86, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xDD, 0xD1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '5'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFE, 0x44, 0x44, 0x44, 0x44, 0x42, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFE, 0x58, 0x88, 0x62, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB3, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xEA, 0x98, 0xAE, 0xFF, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x02, 0x93, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x0D, 0x83, 0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x0E, 0xFF, 0xFD, 0xBC, 0xEF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00,
+0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x20, 0x00, 0x00,
+0x00, 0x06, 0xBE, 0xFF, 0xFF, 0xFF, 0xFC, 0x60, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x24, 0x56, 0x54, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '6'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x57, 0x88, 0x64, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x00,
+0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xEA, 0x77, 0x9D, 0xFE, 0x00, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xFA, 0x10, 0x00, 0x00, 0x4A, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0A, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0D, 0xFF, 0xFA, 0x01, 0x68, 0x98, 0x51, 0x00, 0x00, 0x00,
+0x00, 0x0F, 0xFF, 0xF9, 0x7E, 0xFF, 0xFF, 0xFE, 0x70, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFE, 0x86, 0x8E, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xE2, 0x00, 0x03, 0xEF, 0xFF, 0xF2, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x9F, 0xFF, 0xF5, 0x00,
+0x00, 0x0F, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x5F, 0xFF, 0xF6, 0x00,
+0x00, 0x0E, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x4F, 0xFF, 0xF7, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x6F, 0xFF, 0xF5, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0xAF, 0xFF, 0xF2, 0x00,
+0x00, 0x01, 0xEF, 0xFF, 0xF4, 0x00, 0x05, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xB8, 0xBF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x19, 0xEF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0x56, 0x64, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '7'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x04, 0x44, 0x44, 0x44, 0x44, 0x4C, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF2, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x08, 0xDD, 0xDD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '8'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x47, 0x88, 0x74, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x01, 0xFF, 0xFF, 0xFB, 0x77, 0xBF, 0xFF, 0xFF, 0x10, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x08, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x00,
+0x00, 0x08, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x80, 0x00,
+0x00, 0x06, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x60, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0x60, 0x00, 0x06, 0xFF, 0xFF, 0x20, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x44, 0x8F, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA1, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6E, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x08, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFE, 0xCC, 0xEF, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0x91, 0x00, 0x19, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x0C, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xC0, 0x00,
+0x00, 0x1F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF1, 0x00,
+0x00, 0x2F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00,
+0x00, 0x2F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF2, 0x00,
+0x00, 0x1F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF1, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFD, 0xAA, 0xDF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+0x00, 0x00, 0x2C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0xD7, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x25, 0x66, 0x52, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '9'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x34, 0x54, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFE, 0x81, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x2D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x20, 0x00, 0x00,
+0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD1, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xE9, 0x78, 0xEF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0x30, 0x00, 0x2E, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x5F, 0xFF, 0xF5, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x6F, 0xFF, 0xF5, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF0, 0x00,
+0x00, 0x5F, 0xFF, 0xFA, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00, 0x3F, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xFA, 0x8A, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xF1, 0x00,
+0x00, 0x00, 0x07, 0xEF, 0xFF, 0xFF, 0xE7, 0x9F, 0xFF, 0xF0, 0x00,
+0x00, 0x00, 0x00, 0x16, 0x89, 0x96, 0x10, 0xAF, 0xFF, 0xD0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xA0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00,
+0x00, 0x00, 0xA3, 0x00, 0x00, 0x01, 0xAF, 0xFF, 0xFA, 0x00, 0x00,
+0x00, 0x00, 0xEF, 0xD9, 0x77, 0x9E, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x47, 0x88, 0x75, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// ':'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBE, 0xEE, 0xEB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x23, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x34, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBD, 0xDD, 0xDA, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// ';'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBE, 0xEE, 0xEB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x23, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x34, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xAA, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '<'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7D, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xAF, 0xFF, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0xDF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xD7, 0x00,
+0x00, 0x00, 0x02, 0x8E, 0xFF, 0xFF, 0xFF, 0xFE, 0x93, 0x00, 0x00,
+0x00, 0x15, 0xBF, 0xFF, 0xFF, 0xFF, 0xEA, 0x50, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xB6, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFF, 0xFC, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFF, 0xE7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFC, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x4A, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x17, 0xCF, 0xFF, 0xFF, 0xFF, 0xEA, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x03, 0x9E, 0xFF, 0xFF, 0xFF, 0xFE, 0x93, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xBF, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8C, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '='
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x89, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x98, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0x45, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xCE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEC, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '>'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xD7, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFF, 0xFA, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFD, 0x82, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x7D, 0xFF, 0xFF, 0xFF, 0xFF, 0xB5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x39, 0xEF, 0xFF, 0xFF, 0xFF, 0xE8, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x05, 0xAE, 0xFF, 0xFF, 0xFF, 0xFB, 0x51, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x6B, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0xCF, 0xFF, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x7E, 0xFF, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x16, 0xCF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x5B, 0xFF, 0xFF, 0xFF, 0xFF, 0xA4, 0x00,
+0x00, 0x00, 0x04, 0xAE, 0xFF, 0xFF, 0xFF, 0xFC, 0x71, 0x00, 0x00,
+0x00, 0x39, 0xEF, 0xFF, 0xFF, 0xFF, 0xE9, 0x30, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFF, 0xFE, 0x93, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xDF, 0xFB, 0x61, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xC8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '?'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x47, 0x88, 0x85, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x02, 0x9E, 0xFF, 0xFF, 0xFF, 0xFA, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xC8, 0x78, 0xCF, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x00, 0x7F, 0x92, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x43, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1D, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBC, 0xCC, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCD, 0xDD, 0x70, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '@'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x57, 0x76, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x17, 0xDF, 0xFF, 0xFF, 0xFD, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00, 0x00,
+0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xEC, 0xCE, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x03, 0xEF, 0xFF, 0xB4, 0x00, 0x00, 0x4D, 0xFF, 0xF3, 0x00,
+0x00, 0x0D, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x02, 0xEF, 0xF9, 0x00,
+0x00, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFD, 0x00,
+0x00, 0xDF, 0xFD, 0x00, 0x00, 0x02, 0x56, 0x40, 0x4F, 0xFF, 0x00,
+0x04, 0xFF, 0xF5, 0x00, 0x03, 0xCF, 0xFF, 0xFD, 0x6F, 0xFF, 0x10,
+0x09, 0xFF, 0xE0, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+0x0C, 0xFF, 0x90, 0x00, 0xDF, 0xFF, 0xEB, 0xCF, 0xFF, 0xFF, 0x10,
+0x0F, 0xFF, 0x60, 0x05, 0xFF, 0xFB, 0x10, 0x04, 0xEF, 0xFF, 0x10,
+0x2F, 0xFF, 0x40, 0x09, 0xFF, 0xE1, 0x00, 0x00, 0x7F, 0xFF, 0x10,
+0x3F, 0xFF, 0x20, 0x0C, 0xFF, 0xB0, 0x00, 0x00, 0x2F, 0xFF, 0x10,
+0x3F, 0xFF, 0x20, 0x0D, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0x10,
+0x3F, 0xFF, 0x20, 0x0D, 0xFF, 0xA0, 0x00, 0x00, 0x1F, 0xFF, 0x10,
+0x2F, 0xFF, 0x30, 0x0B, 0xFF, 0xC0, 0x00, 0x00, 0x4F, 0xFF, 0x10,
+0x1F, 0xFF, 0x50, 0x08, 0xFF, 0xF4, 0x00, 0x00, 0xBF, 0xFF, 0x10,
+0x0E, 0xFF, 0x80, 0x02, 0xFF, 0xFE, 0x73, 0x4A, 0xFF, 0xFF, 0x10,
+0x0B, 0xFF, 0xC0, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10,
+0x06, 0xFF, 0xF2, 0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xCF, 0xFF, 0x10,
+0x01, 0xFF, 0xFA, 0x00, 0x00, 0x5B, 0xEF, 0xD7, 0x29, 0x99, 0x10,
+0x00, 0x9F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x2E, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x06, 0xFF, 0xFE, 0x50, 0x00, 0x00, 0x00, 0x01, 0x40, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFC, 0x62, 0x00, 0x13, 0x8E, 0xE1, 0x00,
+0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+0x00, 0x00, 0x00, 0x4D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5A, 0xEF, 0xFF, 0xFF, 0xEA, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x34, 0x32, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'A'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4F, 0xFF, 0xEE, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x8F, 0xFF, 0xBB, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xCF, 0xFF, 0x88, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0x45, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0x11, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x09, 0xFF, 0xFD, 0x00, 0xDF, 0xFF, 0x90, 0x00, 0x00,
+0x00, 0x00, 0x0D, 0xFF, 0xF9, 0x00, 0x9F, 0xFF, 0xD0, 0x00, 0x00,
+0x00, 0x00, 0x2F, 0xFF, 0xF6, 0x00, 0x6F, 0xFF, 0xF2, 0x00, 0x00,
+0x00, 0x00, 0x6F, 0xFF, 0xF2, 0x00, 0x2F, 0xFF, 0xF6, 0x00, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xE0, 0x00, 0x0E, 0xFF, 0xFA, 0x00, 0x00,
+0x00, 0x00, 0xEF, 0xFF, 0xD6, 0x66, 0x6D, 0xFF, 0xFE, 0x00, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0xBB, 0xBB, 0xBB, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x5F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF5, 0x00,
+0x00, 0x9F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF9, 0x00,
+0x00, 0xDF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x00,
+0x02, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x20,
+0x06, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0x60,
+0x09, 0xDD, 0xDD, 0x40, 0x00, 0x00, 0x00, 0x04, 0xDD, 0xDD, 0x90,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'B'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xB6, 0x10, 0x00, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD4, 0x00, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00,
+0x00, 0x4F, 0xFF, 0xFE, 0xCC, 0xCC, 0xEF, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x18, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF3, 0x00,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF3, 0x00,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF1, 0x00,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x4F, 0xFF, 0xFB, 0x66, 0x66, 0x9E, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE9, 0x10, 0x00, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x00,
+0x00, 0x4F, 0xFF, 0xFC, 0x88, 0x89, 0xBE, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xCF, 0xFF, 0xF5, 0x00,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFB, 0x00,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x00,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x10,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0x10,
+0x00, 0x4F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFF, 0x00,
+0x00, 0x4F, 0xFF, 0xF9, 0x11, 0x11, 0x37, 0xEF, 0xFF, 0xFB, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x00, 0x00,
+0x00, 0x3D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDB, 0x96, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'C'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x88, 0x86, 0x30, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x6D, 0xFF, 0xFF, 0xFF, 0xFE, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x01, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFD, 0xEF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xE6, 0x10, 0x02, 0x8E, 0xC0, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x02, 0xA0, 0x00,
+0x00, 0x01, 0xEF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0A, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xEF, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x04, 0xB0, 0x00,
+0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xF9, 0x31, 0x14, 0xAF, 0xC0, 0x00,
+0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x56, 0x54, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'D'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFD, 0xA6, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x55, 0x7B, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF5, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF8, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFA, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFB, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF9, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF7, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF4, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xE1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0x88, 0xAE, 0xFF, 0xFF, 0xFF, 0x20, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00,
+0x00, 0x1D, 0xDD, 0xDD, 0xDD, 0xCA, 0x73, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'E'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x20, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x94, 0x44, 0x44, 0x44, 0x44, 0x40, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xA6, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xA7, 0x77, 0x77, 0x77, 0x77, 0x70, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x07, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xD1, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'F'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xB4, 0x44, 0x44, 0x44, 0x44, 0x41, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xC6, 0x66, 0x66, 0x66, 0x66, 0x20, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x04, 0xDD, 0xDD, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'G'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x57, 0x88, 0x74, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xED, 0xEF, 0xFF, 0xA0, 0x00,
+0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xA3, 0x00, 0x03, 0xAF, 0xA0, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x05, 0xA0, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x4F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x01, 0x88, 0x88, 0x88, 0x85, 0x00,
+0x00, 0x6F, 0xFF, 0xFB, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF9, 0x00,
+0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF9, 0x00,
+0x00, 0x4F, 0xFF, 0xFD, 0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xF9, 0x00,
+0x00, 0x3F, 0xFF, 0xFF, 0x00, 0x01, 0x99, 0x9D, 0xFF, 0xF9, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x0A, 0xFF, 0xF9, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0A, 0xFF, 0xF9, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x0A, 0xFF, 0xF9, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFA, 0x00, 0x00, 0x0A, 0xFF, 0xF9, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xB4, 0x11, 0x4D, 0xFF, 0xF9, 0x00,
+0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00,
+0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFF, 0xB5, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x65, 0x41, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'H'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0x88, 0x88, 0x88, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xBB, 0xBB, 0xBB, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1F, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x1D, 0xDD, 0xDC, 0x00, 0x00, 0x00, 0xCD, 0xDD, 0xD1, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'I'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x10, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x02, 0x44, 0x44, 0x9F, 0xFF, 0xF9, 0x44, 0x44, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x03, 0x77, 0x77, 0xBF, 0xFF, 0xFB, 0x77, 0x77, 0x30, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x06, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'J'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x12, 0x22, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x24, 0x44, 0x44, 0x8F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x8E, 0x60, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xF6, 0x00, 0x00,
+0x00, 0x8F, 0xFD, 0x73, 0x11, 0x4C, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x8C, 0xFF, 0xFF, 0xFF, 0xFB, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x14, 0x56, 0x54, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'K'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x12, 0x22, 0x21, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x20,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x60,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF9, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x8F, 0xFF, 0xFE, 0x20, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x05, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x2E, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x01, 0xCF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x0A, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x7F, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xFC, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0xE2, 0xCF, 0xFF, 0xF9, 0x00, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0x50, 0x4F, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xFA, 0x00, 0x0B, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0xAF, 0xFF, 0xFB, 0x00, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFD, 0x00,
+0x00, 0x6F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0x70,
+0x00, 0x5D, 0xDD, 0xD7, 0x00, 0x00, 0x00, 0x07, 0xDD, 0xDD, 0xC0,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'L'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x12, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFA, 0x77, 0x77, 0x77, 0x77, 0x76, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+0x00, 0x00, 0x7D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDC, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'M'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x22, 0x22, 0x22, 0x00, 0x00, 0x00, 0x22, 0x22, 0x22, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0x30, 0x00, 0x03, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0x70, 0x00, 0x07, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xE0, 0x00, 0x1F, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xDF, 0xF8, 0x00, 0x8F, 0xFD, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x9F, 0xFC, 0x00, 0xCF, 0xF9, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x6E, 0xFF, 0x12, 0xFF, 0xF6, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x6B, 0xFF, 0x56, 0xFF, 0xB6, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x68, 0xFF, 0x9A, 0xFF, 0x86, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x64, 0xFF, 0xDE, 0xFF, 0x46, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0xFF, 0xFF, 0xFF, 0x16, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0xBF, 0xFF, 0xFC, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x8F, 0xFF, 0xF8, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x4F, 0xFF, 0xF4, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x1C, 0xCC, 0xC1, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFD, 0x00,
+0x00, 0xBD, 0xDD, 0x50, 0x00, 0x00, 0x00, 0x05, 0xDD, 0xDB, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'N'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x12, 0x22, 0x22, 0x00, 0x00, 0x00, 0x02, 0x22, 0x21, 0x00,
+0x00, 0x5F, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x20, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xFA, 0xFF, 0xD0, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF4, 0xFF, 0xF4, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0xDF, 0xFA, 0x00, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x8F, 0xFF, 0x10, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x2F, 0xFF, 0x60, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x0B, 0xFF, 0xC0, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x06, 0xFF, 0xF3, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x01, 0xEF, 0xF9, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x9F, 0xFE, 0x1F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x3F, 0xFF, 0x6F, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x0C, 0xFF, 0xCF, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x01, 0xFF, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x5F, 0xFF, 0xF0, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xF5, 0x00,
+0x00, 0x4D, 0xDD, 0xD0, 0x00, 0x00, 0x02, 0xDD, 0xDD, 0xD4, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'O'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x47, 0x88, 0x74, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xE5, 0x00, 0x5E, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0x60, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x2F, 0xFF, 0xFE, 0x10, 0x00, 0x01, 0xEF, 0xFF, 0xF2, 0x00,
+0x00, 0x6F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0x00,
+0x00, 0x8F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x00,
+0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x00,
+0x00, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0xCF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00,
+0x00, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x00,
+0x00, 0x8F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x00,
+0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF5, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0x10, 0x00, 0x01, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0xF7, 0x22, 0x7F, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00,
+0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x14, 0x66, 0x41, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'P'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xA6, 0x10, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE5, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE1, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x51, 0x11, 0x4A, 0xFF, 0xFF, 0xF7, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0xBF, 0xFF, 0xFA, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x4F, 0xFF, 0xFD, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x5F, 0xFF, 0xFD, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x8F, 0xFF, 0xFB, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x04, 0xEF, 0xFF, 0xF8, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xB9, 0x9A, 0xDF, 0xFF, 0xFF, 0xF3, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x60, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xA8, 0x87, 0x64, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xDD, 0xDD, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'Q'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x47, 0x88, 0x74, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x5D, 0xFF, 0xFF, 0xFF, 0xD5, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xEE, 0xFF, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xE5, 0x00, 0x5E, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0x60, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x2F, 0xFF, 0xFE, 0x10, 0x00, 0x01, 0xEF, 0xFF, 0xF2, 0x00,
+0x00, 0x6F, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF6, 0x00,
+0x00, 0x8F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x00,
+0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x00,
+0x00, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0xCF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFC, 0x00,
+0x00, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0xBF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFB, 0x00,
+0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFA, 0x00,
+0x00, 0x8F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x00,
+0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF5, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0x10, 0x00, 0x01, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0xF7, 0x22, 0x7F, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3B, 0xFF, 0xFF, 0xFF, 0xFE, 0x30, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x14, 0x66, 0xEF, 0xFF, 0xE3, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFE, 0x30, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFE, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xC2, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'R'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x22, 0x22, 0x22, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x94, 0x00, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB1, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x11, 0x12, 0x7E, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x2F, 0xFF, 0xFD, 0x22, 0x24, 0x9F, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x50, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x5E, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x04, 0xFF, 0xFF, 0xF2, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0xAF, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x20, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF9, 0x00,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x20,
+0x00, 0x2F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x90,
+0x00, 0x2D, 0xDD, 0xDB, 0x00, 0x00, 0x00, 0x04, 0xDD, 0xDD, 0xD1,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'S'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x57, 0x88, 0x75, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0xFD, 0x83, 0x00, 0x00,
+0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFC, 0x98, 0x9C, 0xFF, 0xFD, 0x00, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x17, 0xED, 0x00, 0x00,
+0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x17, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x2F, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0F, 0xFF, 0xFF, 0xC4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0A, 0xFF, 0xFF, 0xFF, 0xC6, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xEA, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFA, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x02, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x03, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x6C, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xF3, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF4, 0x00,
+0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF4, 0x00,
+0x00, 0x1E, 0x71, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xF2, 0x00,
+0x00, 0x1F, 0xFE, 0x72, 0x00, 0x00, 0x2B, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xDB, 0xAC, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00,
+0x00, 0x1D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00,
+0x00, 0x00, 0x5A, 0xEF, 0xFF, 0xFF, 0xFF, 0xC7, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x46, 0x65, 0x41, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'T'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00,
+0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00,
+0x00, 0x23, 0x33, 0x33, 0x9F, 0xFF, 0xF9, 0x33, 0x33, 0x32, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x7D, 0xDD, 0xD7, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'U'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x12, 0x22, 0x21, 0x00, 0x00, 0x00, 0x12, 0x22, 0x21, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x7F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF7, 0x00,
+0x00, 0x5F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF5, 0x00,
+0x00, 0x3F, 0xFF, 0xFE, 0x20, 0x00, 0x02, 0xEF, 0xFF, 0xF2, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0xD5, 0x22, 0x6D, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00,
+0x00, 0x00, 0x3D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD3, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x8E, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x35, 0x66, 0x53, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'V'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x10,
+0x03, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x30,
+0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFF, 0x00,
+0x00, 0xBF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFB, 0x00,
+0x00, 0x8F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF8, 0x00,
+0x00, 0x4F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF4, 0x00,
+0x00, 0x1F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF1, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x30, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0x60, 0x00, 0x06, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x01, 0xFF, 0xFF, 0x90, 0x00, 0x09, 0xFF, 0xFF, 0x10, 0x00,
+0x00, 0x00, 0xDF, 0xFF, 0xC0, 0x00, 0x0D, 0xFF, 0xFD, 0x00, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xF1, 0x00, 0x1F, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0xF6, 0x00, 0x00,
+0x00, 0x00, 0x2F, 0xFF, 0xF7, 0x00, 0x7F, 0xFF, 0xF2, 0x00, 0x00,
+0x00, 0x00, 0x0E, 0xFF, 0xFA, 0x00, 0xAF, 0xFF, 0xE0, 0x00, 0x00,
+0x00, 0x00, 0x0A, 0xFF, 0xFD, 0x00, 0xDF, 0xFF, 0xA0, 0x00, 0x00,
+0x00, 0x00, 0x06, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x03, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0x30, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xEF, 0xFF, 0x88, 0xFF, 0xFE, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xBF, 0xFF, 0xBB, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xEE, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xDD, 0xDD, 0xDD, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'W'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x12, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x21,
+0x4F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xF4,
+0x2F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF2,
+0x0F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF0,
+0x0D, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xE0,
+0x0B, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xC0,
+0x0A, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xA0,
+0x08, 0xFF, 0xFA, 0x00, 0x19, 0x99, 0x91, 0x00, 0x8F, 0xFF, 0x90,
+0x06, 0xFF, 0xFB, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0x9F, 0xFF, 0x70,
+0x04, 0xFF, 0xFD, 0x00, 0x7F, 0xFF, 0xF8, 0x00, 0xAF, 0xFF, 0x50,
+0x02, 0xFF, 0xFE, 0x00, 0x9F, 0xFF, 0xFB, 0x00, 0xBF, 0xFF, 0x30,
+0x00, 0xFF, 0xFF, 0x00, 0xCF, 0xFF, 0xFE, 0x00, 0xDF, 0xFF, 0x20,
+0x00, 0xDF, 0xFF, 0x20, 0xFF, 0xFF, 0xFF, 0x20, 0xEF, 0xFF, 0x00,
+0x00, 0xCF, 0xFF, 0x33, 0xFF, 0xDD, 0xFF, 0x50, 0xFF, 0xFD, 0x00,
+0x00, 0xAF, 0xFF, 0x55, 0xFF, 0xA9, 0xFF, 0x81, 0xFF, 0xFB, 0x00,
+0x00, 0x8F, 0xFF, 0x68, 0xFF, 0x76, 0xFF, 0xC2, 0xFF, 0xFA, 0x00,
+0x00, 0x6F, 0xFF, 0x8B, 0xFF, 0x33, 0xFF, 0xE4, 0xFF, 0xF8, 0x00,
+0x00, 0x4F, 0xFF, 0x9D, 0xFF, 0x10, 0xEF, 0xF7, 0xFF, 0xF6, 0x00,
+0x00, 0x2F, 0xFF, 0xCF, 0xFC, 0x00, 0xBF, 0xFC, 0xFF, 0xF5, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xF9, 0x00, 0x8F, 0xFF, 0xFF, 0xF3, 0x00,
+0x00, 0x0E, 0xFF, 0xFF, 0xF6, 0x00, 0x5F, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xF3, 0x00, 0x2F, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x0A, 0xFF, 0xFF, 0xF1, 0x00, 0x0D, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xC0, 0x00, 0x0A, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0x90, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x04, 0xDD, 0xDD, 0x60, 0x00, 0x03, 0xDD, 0xDD, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'X'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x01, 0x22, 0x22, 0x10, 0x00, 0x00, 0x00, 0x01, 0x22, 0x22, 0x10,
+0x05, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x50,
+0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFB, 0x00,
+0x00, 0x3F, 0xFF, 0xFD, 0x10, 0x00, 0x01, 0xDF, 0xFF, 0xF3, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x01, 0xEF, 0xFF, 0xE2, 0x00, 0x2E, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x00, 0x6F, 0xFF, 0xFA, 0x00, 0xAF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x34, 0xFF, 0xFF, 0xD0, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0xCC, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0xEF, 0xFF, 0xEE, 0xFF, 0xFE, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x09, 0xFF, 0xFF, 0x78, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+0x00, 0x00, 0x3F, 0xFF, 0xFD, 0x11, 0xDF, 0xFF, 0xF3, 0x00, 0x00,
+0x00, 0x00, 0xBF, 0xFF, 0xF5, 0x00, 0x5F, 0xFF, 0xFB, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xB0, 0x00, 0x0C, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x1D, 0xFF, 0xFF, 0x30, 0x00, 0x03, 0xFF, 0xFF, 0xD1, 0x00,
+0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF8, 0x00,
+0x02, 0xEF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFE, 0x20,
+0x08, 0xDD, 0xDD, 0x70, 0x00, 0x00, 0x00, 0x07, 0xDD, 0xDD, 0x80,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'Y'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0x22, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x22, 0x20,
+0x0D, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0,
+0x06, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x60,
+0x00, 0xDF, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xFD, 0x00,
+0x00, 0x5F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF5, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0x50, 0x00, 0x06, 0xFF, 0xFF, 0xD0, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xD0, 0x00, 0x0D, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0xCF, 0xFF, 0xF5, 0x00, 0x5F, 0xFF, 0xFC, 0x00, 0x00,
+0x00, 0x00, 0x5F, 0xFF, 0xFC, 0x00, 0xCF, 0xFF, 0xF5, 0x00, 0x00,
+0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x45, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0xCC, 0xFF, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x7D, 0xDD, 0xD7, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'Z'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0x04, 0x44, 0x44, 0x44, 0x44, 0x48, 0xFF, 0xFF, 0xF8, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xFE, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xB0, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFE, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xCF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x3F, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xCF, 0xFF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3F, 0xFF, 0xFF, 0xB7, 0x77, 0x77, 0x77, 0x77, 0x77, 0x10,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x20,
+0x00, 0x5D, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x20,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '['
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x33, 0x33, 0x33, 0x33, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xCB, 0xBB, 0x30, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x77, 0x77, 0x77, 0x77, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '\'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x12, 0x22, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3F, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0B, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x04, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xCF, 0xFE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x5F, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0D, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x06, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xDF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x1E, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x08, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xEF, 0xFA, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0A, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xFE, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDF, 0xFD, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0x50, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xC0, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEF, 0xFB, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0x30, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1E, 0xFF, 0xA0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xFF, 0xF3, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// ']'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0x33, 0x33, 0x33, 0x33, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x03, 0xBB, 0xBC, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x02, 0x77, 0x77, 0x77, 0x77, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '^'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x22, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x0A, 0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0x80, 0x00, 0x08, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x2E, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE2, 0x00,
+0x00, 0xCF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x07, 0xFF, 0xFC, 0x00,
+0x01, 0x33, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x23, 0x33, 0x10,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '_'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x31,
+0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5,
+// '`'
+0x00, 0x00, 0x68, 0x88, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x2D, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x02, 0xDF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2D, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0xDF, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xBB, 0xB2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'a'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x34, 0x55, 0x42, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x38, 0xCF, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x00, 0x00,
+0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00,
+0x00, 0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00,
+0x00, 0x00, 0xDF, 0xFC, 0x86, 0x55, 0x8D, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x00, 0xC7, 0x20, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xD0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x56, 0x77, 0x77, 0xCF, 0xFF, 0xF2, 0x00,
+0x00, 0x00, 0x18, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF3, 0x00,
+0x00, 0x03, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+0x00, 0x5F, 0xFF, 0xFF, 0xC6, 0x32, 0x11, 0xAF, 0xFF, 0xF4, 0x00,
+0x00, 0x9F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0xAF, 0xFF, 0xF4, 0x00,
+0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF4, 0x00,
+0x00, 0xBF, 0xFF, 0xF8, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF4, 0x00,
+0x00, 0x9F, 0xFF, 0xFB, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xF4, 0x00,
+0x00, 0x5F, 0xFF, 0xFF, 0x82, 0x03, 0xBF, 0xFF, 0xFF, 0xF4, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00,
+0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0xFB, 0xAF, 0xFF, 0xF4, 0x00,
+0x00, 0x00, 0x2A, 0xFF, 0xFF, 0xFE, 0x70, 0x8D, 0xDD, 0xD3, 0x00,
+0x00, 0x00, 0x00, 0x14, 0x66, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'b'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x02, 0x44, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x12, 0xBF, 0xFF, 0xFC, 0x40, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x2D, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xEC, 0xEF, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xFA, 0x10, 0x1A, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xDF, 0xFF, 0xF6, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x30, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0xCF, 0xFF, 0xF6, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xF8, 0x00, 0x08, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xDA, 0xCF, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x0B, 0xDD, 0xDD, 0x12, 0xCF, 0xFF, 0xFD, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x56, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'c'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x55, 0x31, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x8D, 0xFF, 0xFF, 0xFF, 0xB5, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFE, 0xBA, 0xBE, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x81, 0x00, 0x00, 0x5D, 0x70, 0x00,
+0x00, 0x00, 0xEF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0xEF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x4C, 0x70, 0x00,
+0x00, 0x00, 0x1E, 0xFF, 0xFF, 0xFE, 0xB9, 0xBE, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x5E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x9E, 0xFF, 0xFF, 0xFF, 0xC6, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x66, 0x41, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'd'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x44, 0x20, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x04, 0xCF, 0xFF, 0xFB, 0x21, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0xFE, 0xCE, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0xA1, 0x01, 0xAF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xCF, 0xFF, 0xF2, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xCF, 0xFF, 0xF1, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xCF, 0xFF, 0xF2, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0x80, 0x00, 0x8F, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0xFC, 0xAD, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x06, 0xDF, 0xFF, 0xFC, 0x21, 0xDD, 0xDD, 0xB0, 0x00,
+0x00, 0x00, 0x00, 0x03, 0x65, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'e'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0x45, 0x41, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3A, 0xEF, 0xFF, 0xFF, 0xC6, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC2, 0x00, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x10, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0xFC, 0x88, 0xAE, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x70, 0x00, 0x02, 0xEF, 0xFF, 0xF2, 0x00,
+0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF7, 0x00,
+0x00, 0x7F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x00,
+0x00, 0xAF, 0xFF, 0xFA, 0x88, 0x88, 0x88, 0x9F, 0xFF, 0xFD, 0x00,
+0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+0x00, 0xAF, 0xFF, 0xF5, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x4F, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00,
+0x00, 0x0D, 0xFF, 0xFF, 0x91, 0x00, 0x00, 0x00, 0x4A, 0xF2, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFE, 0xA8, 0x88, 0xAE, 0xFF, 0xF2, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x00, 0x00, 0x3A, 0xEF, 0xFF, 0xFF, 0xFF, 0xD8, 0x30, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0x56, 0x65, 0x31, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'f'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x33, 0x33, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7C, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xFE, 0xA9, 0x99, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xCF, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x06, 0xDD, 0xDD, 0xFF, 0xFF, 0xFD, 0xDD, 0xDD, 0xB0, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x06, 0xDD, 0xDD, 0xFF, 0xFF, 0xFD, 0xDD, 0xDD, 0xB0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBD, 0xDD, 0xD1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'g'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x45, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x02, 0xBF, 0xFF, 0xFD, 0x50, 0xBD, 0xDD, 0xD1, 0x00,
+0x00, 0x00, 0x3E, 0xFF, 0xFF, 0xFF, 0xF6, 0xDF, 0xFF, 0xF1, 0x00,
+0x00, 0x01, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xFE, 0xAC, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x0E, 0xFF, 0xFF, 0xB1, 0x00, 0x6F, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x4F, 0xFF, 0xFE, 0x10, 0x00, 0x0A, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x7F, 0xFF, 0xF9, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x9F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00,
+0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00,
+0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xF1, 0x00,
+0x00, 0x8F, 0xFF, 0xF7, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x6F, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0x50, 0x00, 0x1E, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0xF7, 0x45, 0xDF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF1, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFC, 0xDF, 0xFF, 0xF1, 0x00,
+0x00, 0x00, 0x07, 0xEF, 0xFF, 0xFF, 0xC2, 0xDF, 0xFF, 0xF1, 0x00,
+0x00, 0x00, 0x00, 0x16, 0x9A, 0x95, 0x00, 0xDF, 0xFF, 0xF0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xE0, 0x00,
+0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x00, 0xBC, 0x73, 0x00, 0x01, 0x7F, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0xBF, 0xFF, 0xFE, 0xEF, 0xFF, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x26, 0xAC, 0xEF, 0xFF, 0xDB, 0x71, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'h'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x33, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x01, 0x45, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x71, 0x9F, 0xFF, 0xFD, 0x50, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x7C, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xDB, 0xEF, 0xFF, 0xFF, 0x30, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1D, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x05, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x06, 0xDD, 0xDD, 0x60, 0x00, 0x03, 0xDD, 0xDD, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'i'
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x09, 0xBB, 0xBB, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8D, 0xDD, 0xDD, 0xDD, 0xDD, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x8D, 0xDD, 0xDF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xDD, 0xDD, 0xDF, 0xFF, 0xFF, 0xDD, 0xDD, 0xDD, 0x20,
+0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30,
+0x00, 0x0C, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0x20,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'j'
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xBB, 0xBB, 0xB0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0D, 0xDD, 0xDD, 0xDD, 0xDD, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x0D, 0xDD, 0xDD, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+0x00, 0x0B, 0xBB, 0xBC, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00,
+0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0E, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0E, 0xFF, 0xFF, 0xFE, 0xC8, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'k'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x33, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x01, 0xCD, 0xDD, 0xDB, 0x10,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x1C, 0xFF, 0xFF, 0xD2, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x01, 0xBF, 0xFF, 0xFD, 0x20, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x0A, 0xFF, 0xFF, 0xC1, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x9F, 0xFF, 0xFC, 0x10, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x88, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xDF, 0xFF, 0xFC, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFB, 0xAF, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xB1, 0x1E, 0xFF, 0xFE, 0x10, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x07, 0xFF, 0xFF, 0xA0, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0xCF, 0xFF, 0xF5, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x4F, 0xFF, 0xFD, 0x10, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x0A, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x02, 0xEF, 0xFF, 0xF3, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x8F, 0xFF, 0xFC, 0x00,
+0x00, 0x06, 0xDD, 0xDD, 0x70, 0x00, 0x00, 0x1C, 0xDD, 0xDD, 0x60,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'l'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x23, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x89, 0x99, 0x9E, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x60, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xD3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xED, 0xDD, 0xD0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x6A, 0xDD, 0xDD, 0xDD, 0xD0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'm'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0x44, 0x10, 0x00, 0x25, 0x41, 0x00, 0x00,
+0x00, 0xCD, 0xD8, 0x4E, 0xFF, 0xE4, 0x09, 0xFF, 0xFE, 0x60, 0x00,
+0x00, 0xEF, 0xFB, 0xFF, 0xFF, 0xFE, 0x8F, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00,
+0x00, 0xEF, 0xFF, 0xC6, 0xBF, 0xFF, 0xFC, 0x6B, 0xFF, 0xFB, 0x00,
+0x00, 0xEF, 0xFF, 0x40, 0x2F, 0xFF, 0xF3, 0x03, 0xFF, 0xFD, 0x00,
+0x00, 0xEF, 0xFF, 0x20, 0x0F, 0xFF, 0xF1, 0x01, 0xFF, 0xFE, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xEF, 0xFF, 0x10, 0x0E, 0xFF, 0xF0, 0x00, 0xFF, 0xFF, 0x00,
+0x00, 0xCD, 0xDD, 0x10, 0x0C, 0xDD, 0xD0, 0x00, 0xDD, 0xDD, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'n'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x45, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x06, 0xDD, 0xDD, 0x61, 0x9F, 0xFF, 0xFD, 0x50, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x7C, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xCA, 0xEF, 0xFF, 0xFF, 0x30, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x1D, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x05, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x04, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x06, 0xDD, 0xDD, 0x60, 0x00, 0x03, 0xDD, 0xDD, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'o'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0x55, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3A, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFE, 0xBB, 0xEF, 0xFF, 0xFF, 0x30, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0xC1, 0x00, 0x1C, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x2F, 0xFF, 0xFE, 0x20, 0x00, 0x02, 0xEF, 0xFF, 0xF2, 0x00,
+0x00, 0x6F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0xAF, 0xFF, 0xF6, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFA, 0x00,
+0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFA, 0x00,
+0x00, 0xAF, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFA, 0x00,
+0x00, 0x8F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF8, 0x00,
+0x00, 0x6F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF6, 0x00,
+0x00, 0x2F, 0xFF, 0xFE, 0x10, 0x00, 0x01, 0xEF, 0xFF, 0xF2, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0xB1, 0x00, 0x1B, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFE, 0xAA, 0xEF, 0xFF, 0xFF, 0x30, 0x00,
+0x00, 0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8, 0x00, 0x00,
+0x00, 0x00, 0x08, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x4B, 0xFF, 0xFF, 0xFF, 0xB4, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x14, 0x66, 0x41, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'p'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x44, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x0B, 0xDD, 0xDD, 0x12, 0xBF, 0xFF, 0xFD, 0x50, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x2D, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xBF, 0xFF, 0xFF, 0xFF, 0xFF, 0x30, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xDB, 0xDF, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xF9, 0x00, 0x09, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xDF, 0xFF, 0xF6, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x1F, 0xFF, 0xFC, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x20, 0x00, 0x00, 0x2F, 0xFF, 0xFC, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x4F, 0xFF, 0xFB, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x7F, 0xFF, 0xF9, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0xDF, 0xFF, 0xF6, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xF9, 0x00, 0x09, 0xFF, 0xFF, 0xF2, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xDB, 0xDF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x3E, 0xFF, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x12, 0xCF, 0xFF, 0xFD, 0x50, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x03, 0x55, 0x30, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'q'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x44, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFB, 0x21, 0xDD, 0xDD, 0xB0, 0x00,
+0x00, 0x00, 0x6F, 0xFF, 0xFF, 0xFF, 0xD2, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFB, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0xFD, 0xBD, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0x90, 0x00, 0x9F, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xCF, 0xFF, 0xF2, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xCF, 0xFF, 0xF1, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xCF, 0xFF, 0xF2, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0xBF, 0xFF, 0xF4, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x9F, 0xFF, 0xF7, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x6F, 0xFF, 0xFD, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x2F, 0xFF, 0xFF, 0x90, 0x00, 0x9F, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x0C, 0xFF, 0xFF, 0xFD, 0xBD, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xE3, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x05, 0xDF, 0xFF, 0xFC, 0x21, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x03, 0x55, 0x30, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x10, 0x00,
+// 'r'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x53, 0x00, 0x00,
+0x00, 0x00, 0x06, 0xDD, 0xDD, 0x60, 0x5D, 0xFF, 0xFF, 0xE8, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x78, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xAF, 0xFF, 0xFF, 0xFF, 0xFE, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xFF, 0xED, 0xDF, 0xFE, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0xA3, 0x00, 0x01, 0x6C, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x01, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x06, 0xDD, 0xDD, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 's'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x13, 0x55, 0x42, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6C, 0xFF, 0xFF, 0xFF, 0xFC, 0x81, 0x00, 0x00,
+0x00, 0x00, 0x1B, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xE8, 0x54, 0x57, 0xBF, 0xF4, 0x00, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x02, 0x83, 0x00, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xE7, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFB, 0x84, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x9F, 0xFF, 0xFF, 0xFF, 0xFF, 0xE8, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xD2, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x39, 0xEF, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x02, 0x6A, 0xEF, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1A, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x02, 0xB4, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x02, 0xFF, 0xD9, 0x53, 0x34, 0x7E, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00, 0x00,
+0x00, 0x02, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE3, 0x00, 0x00,
+0x00, 0x00, 0x6A, 0xEF, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x45, 0x66, 0x53, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 't'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0x33, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x7D, 0xDD, 0xDE, 0xFF, 0xFF, 0xED, 0xDD, 0xDD, 0x80, 0x00,
+0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x8F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x7D, 0xDD, 0xDE, 0xFF, 0xFF, 0xED, 0xDD, 0xDD, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x08, 0xFF, 0xFF, 0xB1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xDD, 0xDD, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4E, 0xFF, 0xFF, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0x6A, 0xCD, 0xDD, 0xDD, 0x80, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'u'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x08, 0xDD, 0xDD, 0x30, 0x00, 0x06, 0xDD, 0xDD, 0x60, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x07, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x40, 0x00, 0x09, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x70, 0x00, 0x0D, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x07, 0xFF, 0xFF, 0xC1, 0x00, 0x7F, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0xFD, 0xAC, 0xFF, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0xEF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xC7, 0xFF, 0xFF, 0x70, 0x00,
+0x00, 0x00, 0x06, 0xEF, 0xFF, 0xFA, 0x16, 0xDD, 0xDD, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x14, 0x65, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'v'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0xBD, 0xDD, 0xD1, 0x00, 0x00, 0x00, 0x1D, 0xDD, 0xDB, 0x00,
+0x00, 0x8F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF8, 0x00,
+0x00, 0x4F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF4, 0x00,
+0x00, 0x0E, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xE0, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0x30, 0x00, 0x03, 0xFF, 0xFF, 0x90, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0x70, 0x00, 0x07, 0xFF, 0xFF, 0x40, 0x00,
+0x00, 0x00, 0xEF, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFE, 0x00, 0x00,
+0x00, 0x00, 0xAF, 0xFF, 0xF1, 0x00, 0x1F, 0xFF, 0xFA, 0x00, 0x00,
+0x00, 0x00, 0x5F, 0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00,
+0x00, 0x00, 0x1E, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xE1, 0x00, 0x00,
+0x00, 0x00, 0x0A, 0xFF, 0xFC, 0x00, 0xCF, 0xFF, 0xA0, 0x00, 0x00,
+0x00, 0x00, 0x06, 0xFF, 0xFF, 0x12, 0xFF, 0xFF, 0x60, 0x00, 0x00,
+0x00, 0x00, 0x01, 0xFF, 0xFF, 0x66, 0xFF, 0xFF, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xBF, 0xFF, 0xAA, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x6F, 0xFF, 0xEE, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF2, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0xDD, 0xDD, 0xDD, 0x20, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'w'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x3D, 0xDD, 0xB0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0xDD, 0xD3,
+0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xF1,
+0x0E, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xE0,
+0x0B, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xB0,
+0x08, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0x80,
+0x05, 0xFF, 0xF9, 0x00, 0x1E, 0xEE, 0xE1, 0x00, 0x9F, 0xFF, 0x50,
+0x03, 0xFF, 0xFB, 0x00, 0x4F, 0xFF, 0xF4, 0x00, 0xBF, 0xFF, 0x30,
+0x00, 0xFF, 0xFD, 0x00, 0x8F, 0xFF, 0xF8, 0x00, 0xEF, 0xFF, 0x00,
+0x00, 0xCF, 0xFF, 0x10, 0xBF, 0xFF, 0xFB, 0x01, 0xFF, 0xFC, 0x00,
+0x00, 0xAF, 0xFF, 0x30, 0xEF, 0xEE, 0xFE, 0x04, 0xFF, 0xFA, 0x00,
+0x00, 0x7F, 0xFF, 0x62, 0xFF, 0xAA, 0xFF, 0x26, 0xFF, 0xF7, 0x00,
+0x00, 0x4F, 0xFF, 0x86, 0xFF, 0x77, 0xFF, 0x58, 0xFF, 0xF4, 0x00,
+0x00, 0x1F, 0xFF, 0xA9, 0xFF, 0x33, 0xFF, 0x8A, 0xFF, 0xF1, 0x00,
+0x00, 0x0E, 0xFF, 0xCC, 0xFE, 0x00, 0xFF, 0xCD, 0xFF, 0xE0, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0xFB, 0x00, 0xBF, 0xEF, 0xFF, 0xB0, 0x00,
+0x00, 0x08, 0xFF, 0xFF, 0xF8, 0x00, 0x8F, 0xFF, 0xFF, 0x80, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xF4, 0x00, 0x4F, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xF1, 0x00, 0x1F, 0xFF, 0xFF, 0x30, 0x00,
+0x00, 0x00, 0xDD, 0xDD, 0xB0, 0x00, 0x0B, 0xDD, 0xDD, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'x'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x7D, 0xDD, 0xDD, 0x20, 0x00, 0x02, 0xDD, 0xDD, 0xD7, 0x00,
+0x00, 0x1D, 0xFF, 0xFF, 0xA0, 0x00, 0x0A, 0xFF, 0xFF, 0xD1, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xF3, 0x00, 0x3F, 0xFF, 0xFF, 0x30, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xFB, 0x00, 0xBF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x0B, 0xFF, 0xFF, 0x55, 0xFF, 0xFF, 0xC0, 0x00, 0x00,
+0x00, 0x00, 0x02, 0xEF, 0xFF, 0xDD, 0xFF, 0xFE, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF3, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x01, 0xDF, 0xFF, 0xEE, 0xFF, 0xFD, 0x10, 0x00, 0x00,
+0x00, 0x00, 0x09, 0xFF, 0xFF, 0x77, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+0x00, 0x00, 0x4F, 0xFF, 0xFD, 0x00, 0xDF, 0xFF, 0xF5, 0x00, 0x00,
+0x00, 0x01, 0xEF, 0xFF, 0xF4, 0x00, 0x5F, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00, 0x0B, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x6F, 0xFF, 0xFF, 0x20, 0x00, 0x02, 0xFF, 0xFF, 0xF6, 0x00,
+0x02, 0xDD, 0xDD, 0xD8, 0x00, 0x00, 0x00, 0x8D, 0xDD, 0xDD, 0x20,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'y'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x02, 0xDD, 0xDD, 0xC0, 0x00, 0x00, 0x00, 0x0C, 0xDD, 0xDD, 0x30,
+0x00, 0xCF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xFD, 0x00,
+0x00, 0x6F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF7, 0x00,
+0x00, 0x1E, 0xFF, 0xFE, 0x10, 0x00, 0x00, 0xEF, 0xFF, 0xF2, 0x00,
+0x00, 0x0A, 0xFF, 0xFF, 0x50, 0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00,
+0x00, 0x04, 0xFF, 0xFF, 0xB0, 0x00, 0x09, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0xDF, 0xFF, 0xF1, 0x00, 0x0E, 0xFF, 0xFE, 0x10, 0x00,
+0x00, 0x00, 0x7F, 0xFF, 0xF6, 0x00, 0x4F, 0xFF, 0xF9, 0x00, 0x00,
+0x00, 0x00, 0x1F, 0xFF, 0xFB, 0x00, 0x9F, 0xFF, 0xF4, 0x00, 0x00,
+0x00, 0x00, 0x0A, 0xFF, 0xFF, 0x20, 0xEF, 0xFF, 0xD0, 0x00, 0x00,
+0x00, 0x00, 0x04, 0xFF, 0xFF, 0x74, 0xFF, 0xFF, 0x70, 0x00, 0x00,
+0x00, 0x00, 0x00, 0xDF, 0xFF, 0xC9, 0xFF, 0xFF, 0x20, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFE, 0xFF, 0xFB, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFF, 0xFF, 0xF6, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xE1, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x05, 0xFF, 0xFF, 0xFF, 0x90, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xEF, 0xFF, 0xFF, 0x40, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF7, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x02, 0xEF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x1B, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x2B, 0xBC, 0xEF, 0xFF, 0xFD, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3F, 0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x3F, 0xFF, 0xFE, 0xB5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// 'z'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xB0, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x02, 0xCC, 0xCC, 0xCC, 0xCC, 0xCE, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xFF, 0xFF, 0xF7, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x2E, 0xFF, 0xFF, 0x90, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xFA, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1C, 0xFF, 0xFF, 0xC1, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x09, 0xFF, 0xFF, 0xE2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x7F, 0xFF, 0xFE, 0x30, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x06, 0xFF, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x4F, 0xFF, 0xFF, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x03, 0xEF, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFB, 0xBB, 0xBB, 0xBB, 0xBB, 0x90, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x09, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+0x00, 0x08, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xB0, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '{'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x23, 0x33, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0xDF, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x03, 0xEF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xFE, 0x51, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF9, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0xBF, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x29, 0xFF, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xEF, 0xFF, 0xFF, 0xFE, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0xFE, 0x91, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFB, 0x10, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x45, 0x7D, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xF4, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x3F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0C, 0xFF, 0xFF, 0xEB, 0xAA, 0x30, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x06, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0xFF, 0xFF, 0xFF, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x36, 0x78, 0x88, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '|'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0x55, 0x40, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0E, 0xFF, 0xD0, 0x00, 0x00, 0x00, 0x00,
+// '}'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x01, 0x33, 0x32, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFD, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFE, 0x20, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0xA0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x15, 0xEF, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x9F, 0xFF, 0xF1, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF5, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x2F, 0xFF, 0xFA, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0D, 0xFF, 0xFF, 0x92, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x04, 0xEF, 0xFF, 0xFF, 0xFE, 0x50, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x19, 0xEF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x01, 0xBF, 0xFF, 0xFF, 0xFF, 0x60, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x0B, 0xFF, 0xFF, 0xD7, 0x44, 0x10, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFD, 0x10, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x4F, 0xFF, 0xF6, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF3, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x5F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x8F, 0xFF, 0xF2, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x01, 0xDF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x03, 0xAA, 0xBE, 0xFF, 0xFF, 0xB0, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xFF, 0x50, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x05, 0xFF, 0xFF, 0xFF, 0xE7, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x02, 0x88, 0x87, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+// '~'
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x27, 0x99, 0x85, 0x10, 0x00, 0x00, 0x00, 0x04, 0x00,
+0x00, 0x1A, 0xFF, 0xFF, 0xFF, 0xE9, 0x20, 0x00, 0x02, 0xAD, 0x00,
+0x00, 0xCF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xA9, 0xCF, 0xFD, 0x00,
+0x00, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0x00,
+0x00, 0xDF, 0x94, 0x21, 0x47, 0xDF, 0xFF, 0xFF, 0xFF, 0xF7, 0x00,
+0x00, 0xA2, 0x00, 0x00, 0x00, 0x05, 0xAE, 0xFF, 0xEA, 0x20, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+FontDef FontAA_22x36 = {22,36,NULL,FontAA22x36};
@@ -0,0 +1,463 @@
+#include "mirror.h"
+
+#include <string.h>
+
+#include "hardware/sync.h"
+#include "hardware/timer.h"
+#include "tusb.h"
+
+#define MIRROR_HEADER 5         // sync, sequence, length
+#define MIRROR_SIZE_OP 5
+#define MIRROR_EMPTY (MIRROR_HEADER + MIRROR_SIZE_OP)
+#define MIRROR_WINDOW_OP 9
+#define MIRROR_SKIP_OP 5
+#define MIRROR_MIN_RUN 3        // shorter runs stay in literals
+#define MIRROR_LONG_RUN 16      // shorter runs go into two color ops when they fit
+#define MIRROR_MONO_MIN 5       // fewest pixels worth a two color op
+#define MIRROR_LITERAL_MAX 64   // pixels per literal op, bounds the unused tail of a buffer
+#define MIRROR_RUN_MAX 0xFFFF
+#define MIRROR_NO_BUFFER 0xFF
+
+struct mirror_rect {
+    u16 x0, y0, x1, y1;
+};
+
+struct mirror_hash {
+    struct mirror_rect rect;
+    u32 hash;       // of the ops that last filled the window on the viewer
+    bool_t valid;
+};
+
+static struct {
+    struct st7789* lcd;
+    spin_lock_t* lock;       // only for claiming capture and handing a buffer over
+    volatile bool_t capturing; // set by whoever owns the active buffer and the delta state
+    u08 buf[2][MIRROR_BUFFER];
+    u08 active;              // buffer the capture hooks write to
+    u16 len;
+    u32 started;             // time_us_32 when the active buffer was started
+    u32 buffers;             // buffers started, a pixel call seeing it change crossed a frame
+    u08 seq;
+    volatile u08 sending;    // buffer owned by the pump, MIRROR_NO_BUFFER when free
+    u16 sendLen;
+    u16 sendPos;
+    volatile bool_t resync;
+    u32 resyncAt;            // time_us_32 of the last St7789MirrorResyncEvent
+    u32 resyncUs;            // wait before the next one, doubles with every drop
+    u32 droppedAt;           // time_us_32 of the last dropped frame
+    struct {
+        struct mirror_rect rect;
+        bool_t open;
+        s32 start;           // offset of its window op in the active buffer, -1 when not there yet
+        u32 written;         // pixels captured since the window was selected
+        bool_t resumed;      // its pixels span several frames, no delta possible
+    } window;
+    struct {
+        s32 start;           // ops of the previous pixel call, -1 when there is nothing to repeat
+        u16 len;
+        u16 end;             // where the next call has to start to be a repeat
+        s32 again;           // its repeat op, -1 before the first repeat
+    } line;
+    struct mirror_hash hashes[MIRROR_WINDOWS];
+    u08 nextHash;
+    struct st7789_mirror_stats stats;
+} mirror = {.sending = MIRROR_NO_BUFFER};
+
+static void put16(u08* p, u16 v) {
+    p[0] = v;
+    p[1] = v >> 8;
+}
+
+static void put32(u08* p, u32 v) {
+    put16(p, v);
+    put16(p + 2, v >> 16);
+}
+
+static u32 mirrorHash(const u08* p, u32 n) {
+    u32 h = 2166136261u; // FNV-1a
+    while(n--) {
+        h ^= *p++;
+        h *= 16777619u;
+    }
+    return h;
+}
+
+static bool_t rectSame(struct mirror_rect a, struct mirror_rect b) {
+    return a.x0 == b.x0 && a.y0 == b.y0 && a.x1 == b.x1 && a.y1 == b.y1;
+}
+
+static bool_t rectOverlap(struct mirror_rect a, struct mirror_rect b) {
+    return a.x0 <= b.x1 && b.x0 <= a.x1 && a.y0 <= b.y1 && b.y0 <= a.y1;
+}
+
+static void mirrorForgetAll() {
+    for(u08 i = 0; i < MIRROR_WINDOWS; i++) mirror.hashes[i].valid = FALSE;
+}
+
+static void mirrorBeginFrame() {
+    u08* p = &mirror.buf[mirror.active][MIRROR_HEADER];
+    p[0] = MIRROR_OP_SIZE;
+    put16(p + 1, mirror.lcd->width);
+    put16(p + 3, mirror.lcd->height);
+    mirror.len = MIRROR_EMPTY;
+    mirror.started = time_us_32();
+    mirror.buffers++;
+    mirror.line.start = -1;
+}
+
+// Decides on the ops of the open window in the active buffer: they are taken out
+// again when the viewer already shows exactly them, otherwise their hash replaces
+// whatever was remembered for the window and for anything it overlaps.
+static void mirrorSettle() {
+    if(!mirror.window.open || mirror.window.start < 0) return;
+    struct mirror_rect r = mirror.window.rect;
+    struct mirror_hash* same = NULL;
+    for(u08 i = 0; i < MIRROR_WINDOWS; i++) {
+        if(mirror.hashes[i].valid && rectSame(mirror.hashes[i].rect, r)) same = &mirror.hashes[i];
+    }
+    u32 hash = 0;
+    if(!mirror.window.resumed) {
+        u32 ops = mirror.window.start + MIRROR_WINDOW_OP;
+        hash = mirrorHash(&mirror.buf[mirror.active][ops], mirror.len - ops);
+        if(same != NULL && same->hash == hash) {
+            mirror.len = mirror.window.start;
+            mirror.window.start = -1;
+            mirror.stats.skipped++;
+            return;
+        }
+    }
+    for(u08 i = 0; i < MIRROR_WINDOWS; i++) {
+        if(rectOverlap(mirror.hashes[i].rect, r)) mirror.hashes[i].valid = FALSE;
+    }
+    if(!mirror.window.resumed) {
+        if(same == NULL) {
+            same = &mirror.hashes[mirror.nextHash];
+            mirror.nextHash = (mirror.nextHash + 1) % MIRROR_WINDOWS;
+        }
+        same->rect = r;
+        same->hash = hash;
+        same->valid = TRUE;
+    }
+    mirror.window.start = -1;
+}
+
+static bool_t mirrorTryClaim() {
+    u32 irq = spin_lock_blocking(mirror.lock);
+    bool_t free = !mirror.capturing;
+    if(free) mirror.capturing = TRUE;
+    spin_unlock(mirror.lock, irq);
+    return free;
+}
+
+// Encoding runs with interrupts on, the other core waits here while one draws.
+static void mirrorClaim() {
+    while(!mirrorTryClaim()) tight_loop_contents();
+}
+
+static void mirrorRelease() {
+    __dmb();
+    mirror.capturing = FALSE;
+}
+
+// Hands the active buffer to the pump, or drops it when the previous frame is
+// still on its way. Capture continues in the other buffer either way. Every drop
+// doubles the wait for the next resync, the first frame sent after MIRROR_RESYNC_US
+// without a drop brings it back.
+static void mirrorFlush() {
+    mirrorSettle();
+    if(mirror.len > MIRROR_EMPTY) {
+        u08* p = mirror.buf[mirror.active];
+        p[0] = MIRROR_SYNC0;
+        p[1] = MIRROR_SYNC1;
+        p[2] = mirror.seq++;
+        put16(p + 3, mirror.len - MIRROR_HEADER);
+        u32 irq = spin_lock_blocking(mirror.lock);
+        bool_t sent = mirror.sending == MIRROR_NO_BUFFER;
+        if(sent) {
+            mirror.sendLen = mirror.len;
+            mirror.sendPos = 0;
+            __dmb();
+            mirror.sending = mirror.active;
+            mirror.active ^= 1;
+            mirror.stats.frames++;
+            if(time_us_32() - mirror.droppedAt >= MIRROR_RESYNC_US) mirror.resyncUs = MIRROR_RESYNC_US;
+        } else {
+            mirror.stats.dropped++;
+            mirror.resync = TRUE;
+            mirror.droppedAt = time_us_32();
+            if(mirror.resyncUs < MIRROR_RESYNC_MAX_US) mirror.resyncUs *= 2;
+        }
+        spin_unlock(mirror.lock, irq);
+        if(!sent) mirrorForgetAll();
+    }
+    mirrorBeginFrame();
+}
+
+static u08* mirrorReserve(u16 n) {
+    if(mirror.len + n > MIRROR_BUFFER) mirrorFlush();
+    u08* p = &mirror.buf[mirror.active][mirror.len];
+    mirror.len += n;
+    return p;
+}
+
+// Room for a pixel op, preceded by the window it draws into when that is not in
+// the active buffer yet. A window continued from an earlier frame skips the pixels
+// the viewer already got.
+static u08* mirrorOp(u16 n) {
+    if(mirror.window.start >= 0 && mirror.len + n > MIRROR_BUFFER) mirrorFlush();
+    if(mirror.window.start < 0) {
+        u16 header = MIRROR_WINDOW_OP + (mirror.window.written ? MIRROR_SKIP_OP : 0);
+        if(mirror.len + header + n > MIRROR_BUFFER) mirrorFlush();
+        mirror.window.start = mirror.len;
+        u08* p = mirrorReserve(MIRROR_WINDOW_OP);
+        p[0] = MIRROR_OP_WINDOW;
+        put16(p + 1, mirror.window.rect.x0);
+        put16(p + 3, mirror.window.rect.y0);
+        put16(p + 5, mirror.window.rect.x1);
+        put16(p + 7, mirror.window.rect.y1);
+        if(mirror.window.written) {
+            p = mirrorReserve(MIRROR_SKIP_OP);
+            p[0] = MIRROR_OP_SKIP;
+            put32(p + 1, mirror.window.written);
+            mirror.window.resumed = TRUE;
+        }
+    }
+    return mirrorReserve(n);
+}
+
+static void mirrorRun(u16 pixel, u32 count) {
+    while(count) {
+        u32 n = count < MIRROR_RUN_MAX ? count : MIRROR_RUN_MAX;
+        u08* p = mirrorOp(5);
+        p[0] = MIRROR_OP_RUN;
+        put16(p + 1, n);
+        put16(p + 3, pixel);
+        mirror.window.written += n;
+        count -= n;
+    }
+}
+
+// Pixel calls that encode to the same bytes as the call right before them, like the
+// repeated lines of a scaled glyph, become one repeat op.
+static void mirrorAgain(u16 begin) {
+    u08* buf = mirror.buf[mirror.active];
+    u16 n = mirror.len - begin;
+    if(mirror.line.start >= 0 && mirror.line.end == begin && mirror.line.len == n &&
+       !memcmp(&buf[begin], &buf[mirror.line.start], n)) {
+        if(mirror.line.again >= 0) {
+            u08* again = &buf[mirror.line.again];
+            u16 times = again[3] | again[4] << 8;
+            if(times < 0xFFFF) {
+                mirror.len = begin;
+                put16(again + 3, times + 1);
+                return;
+            }
+        }
+        if(mirror.line.again < 0) {
+            // every op is at least as long as the repeat op, it fits where the copy was
+            mirror.len = begin;
+            mirror.line.again = begin;
+            u08* p = mirrorReserve(5);
+            p[0] = MIRROR_OP_AGAIN;
+            put16(p + 1, n);
+            put16(p + 3, 1);
+            mirror.line.end = mirror.len;
+            return;
+        }
+    }
+    mirror.line.start = begin;
+    mirror.line.len = n;
+    mirror.line.end = mirror.len;
+    mirror.line.again = -1;
+}
+
+static void mirrorEncode(const u16* pixels, u32 count) {
+    while(count) {
+        u32 n = 1;
+        while(n < count && n < MIRROR_RUN_MAX && pixels[n] == pixels[0]) n++;
+        if(n < MIRROR_LONG_RUN) {
+            // glyphs and icons are mostly two colors, 32 of their pixels fit in 10 bytes
+            u16 bg = pixels[0];
+            u16 fg = bg;
+            u32 bits = 0;
+            u08 m = 0;
+            for(; m < count && m < 32; m++) {
+                if(fg == bg) fg = pixels[m];
+                if(pixels[m] != bg && pixels[m] != fg) break;
+                if(pixels[m] != bg) bits |= 0x80000000 >> m;
+            }
+            if(m >= MIRROR_MONO_MIN && m > n) {
+                u08* p = mirrorOp(10);
+                p[0] = MIRROR_OP_MONO;
+                p[1] = m;
+                put16(p + 2, fg);
+                put16(p + 4, bg);
+                put32(p + 6, bits);
+                mirror.window.written += m;
+                pixels += m;
+                count -= m;
+                continue;
+            }
+        }
+        if(n >= MIRROR_MIN_RUN) {
+            mirrorRun(pixels[0], n);
+        } else {
+            // literal up to where the next run starts
+            for(n = 1; n < count && n < MIRROR_LITERAL_MAX; n++) {
+                if(n + 2 < count && pixels[n] == pixels[n + 1] && pixels[n] == pixels[n + 2]) break;
+            }
+            u08* p = mirrorOp(3 + n * 2);
+            p[0] = MIRROR_OP_LITERAL;
+            put16(p + 1, n);
+            for(u32 i = 0; i < n; i++) put16(p + 3 + i * 2, pixels[i]);
+            mirror.window.written += n;
+        }
+        pixels += n;
+        count -= n;
+    }
+}
+
+void st7789_mirror_size(u16 width, u16 height) {
+    mirrorClaim();
+    mirrorSettle();
+    mirror.window.open = FALSE;
+    mirror.line.start = -1;
+    u08* p = mirrorReserve(MIRROR_SIZE_OP);
+    p[0] = MIRROR_OP_SIZE;
+    put16(p + 1, width);
+    put16(p + 3, height);
+    mirrorRelease();
+}
+
+void st7789_mirror_window(u16 x0, u16 y0, u16 x1, u16 y1) {
+    mirrorClaim();
+    mirrorSettle();
+    mirror.window.rect = (struct mirror_rect){x0, y0, x1, y1};
+    mirror.window.open = TRUE;
+    mirror.window.start = -1;
+    mirror.window.written = 0;
+    mirror.window.resumed = FALSE;
+    mirror.line.start = -1;
+    mirrorRelease();
+}
+
+void st7789_mirror_pixels(const u16* pixels, u32 count) {
+    mirrorClaim();
+    if(mirror.window.open && count) {
+        mirrorOp(0); // the window op must not be part of what the next call compares
+        u32 buffers = mirror.buffers;
+        u16 begin = mirror.len;
+        mirrorEncode(pixels, count);
+        if(mirror.buffers == buffers) mirrorAgain(begin);
+        else mirror.line.start = -1;
+    }
+    mirrorRelease();
+}
+
+void st7789_mirror_repeat(u16 pixel, u32 count) {
+    mirrorClaim();
+    if(mirror.window.open) mirrorRun(pixel, count);
+    mirror.line.start = -1;
+    mirrorRelease();
+}
+
+void st7789_mirror_mono(u32 bits, u08 count, u16 color, u16 bgcolor) {
+    mirrorClaim();
+    if(mirror.window.open && count) {
+        u08* p = mirrorOp(10);
+        p[0] = MIRROR_OP_MONO;
+        p[1] = count;
+        put16(p + 2, color);
+        put16(p + 4, bgcolor);
+        put32(p + 6, bits);
+        mirror.window.written += count;
+    }
+    mirror.line.start = -1;
+    mirrorRelease();
+}
+
+void st7789_mirror_start(struct st7789* lcd) {
+    if(mirror.lock == NULL) mirror.lock = spin_lock_init(spin_lock_claim_unused(true));
+    mirrorClaim();
+    mirror.lcd = lcd;
+    mirror.active = 0;
+    mirror.sending = MIRROR_NO_BUFFER;
+    mirror.window.open = FALSE;
+    mirror.window.start = -1;
+    mirrorForgetAll();
+    mirrorBeginFrame();
+    mirror.resync = TRUE;
+    mirror.resyncUs = MIRROR_RESYNC_US;
+    mirror.resyncAt = time_us_32() - MIRROR_RESYNC_US;
+    mirror.droppedAt = mirror.resyncAt;
+    lcd->mirrored = TRUE;
+    mirrorRelease();
+}
+
+void st7789_mirror_stop(struct st7789* lcd) {
+    if(mirror.lock == NULL) return;
+    mirrorClaim();
+    lcd->mirrored = FALSE;
+    if(mirror.lcd == lcd) {
+        mirror.lcd = NULL;
+        mirror.sending = MIRROR_NO_BUFFER;
+    }
+    mirrorRelease();
+}
+
+bool_t st7789_mirror_pump() {
+    if(mirror.lcd == NULL) return FALSE;
+    bool_t resync = FALSE;
+    // while the other core captures, the frame timer and the resync wait for the next pump
+    if(mirrorTryClaim()) {
+        if(mirror.sending == MIRROR_NO_BUFFER && mirror.len > MIRROR_EMPTY &&
+           time_us_32() - mirror.started >= MIRROR_FRAME_US) {
+            mirrorFlush();
+        }
+        bool_t connected = tud_cdc_connected();
+        if(!connected && mirror.sending != MIRROR_NO_BUFFER) {
+            mirror.sending = MIRROR_NO_BUFFER;
+            mirror.stats.dropped++;
+            mirror.resync = TRUE;
+        }
+        resync = connected && mirror.resync && time_us_32() - mirror.resyncAt >= mirror.resyncUs;
+        if(resync) {
+            // the viewer gets everything drawn from here on, remembered windows are stale
+            mirrorForgetAll();
+            mirror.resync = FALSE;
+            mirror.resyncAt = time_us_32();
+        }
+        mirrorRelease();
+    }
+    if(resync) emitSignal(St7789MirrorResyncEvent, 0, mirror.lcd);
+    if(mirror.sending == MIRROR_NO_BUFFER) return FALSE;
+
+    u32 left = mirror.sendLen - mirror.sendPos;
+    u32 n = tud_cdc_write_available();
+    if(n) {
+        if(n > left) n = left;
+        // stdio_usb runs tud_task from a core 0 interrupt, keep it out while the FIFO changes
+        u32 irq = save_and_disable_interrupts();
+        n = tud_cdc_write(&mirror.buf[mirror.sending][mirror.sendPos], n);
+        tud_cdc_write_flush();
+        restore_interrupts(irq);
+        mirror.sendPos += n;
+        mirror.stats.bytes += n;
+    }
+    if(mirror.sendPos < mirror.sendLen) return TRUE;
+    __dmb();
+    mirror.sending = MIRROR_NO_BUFFER;
+    return FALSE;
+}
+
+const void* St7789MirrorResyncEvent = (void*)st7789_mirror_pump;
+
+void st7789_mirror_stats(struct st7789_mirror_stats* stats) {
+    if(mirror.lock == NULL) {
+        *stats = mirror.stats;
+        return;
+    }
+    u32 irq = spin_lock_blocking(mirror.lock);
+    *stats = mirror.stats;
+    spin_unlock(mirror.lock, irq);
+}
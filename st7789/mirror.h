@@ -0,0 +1,65 @@
+#ifndef _PICO_ST7789_MIRROR_H_
+#define _PICO_ST7789_MIRROR_H_
+
+#include "hardware/spi.h"
+
+#include "st7789.h"
+
+// Streams what is drawn on one panel to USB CDC, tools/mirror_viewer.py shows it.
+// The driver records its own draw stream (windows plus run length and two color
+// packed pixels, a line sent again becomes a repeat of the previous one) into one
+// of two capture buffers, st7789_mirror_pump hands the other one to TinyUSB without
+// ever waiting for it. A window redrawn with exactly the bytes it got last time is
+// dropped from the stream, and a frame that finds the USB side still busy is dropped
+// as a whole. The viewer then misses pixels, so St7789MirrorResyncEvent asks the
+// application to draw everything again, waiting twice as long after every further
+// drop so a host that keeps falling behind does not get a full redraw each time.
+#ifndef MIRROR_BUFFER
+#define MIRROR_BUFFER 4096   // bytes per capture buffer, two of them, a full clock screen needs ~3 KB
+#endif
+#ifndef MIRROR_WINDOWS
+#define MIRROR_WINDOWS 32    // windows remembered for the delta against the previous frame
+#endif
+#define MIRROR_FRAME_US 20000   // a partly filled buffer is sent after this long
+#define MIRROR_RESYNC_US 500000 // at most one full redraw request per this long
+#define MIRROR_RESYNC_MAX_US 8000000 // backoff limit while frames keep being dropped
+
+// Frame: MIRROR_SYNC, u08 sequence, u16 length, then `length` bytes of ops.
+// Every op is its code followed by little endian fields.
+#define MIRROR_SYNC0 0xA5
+#define MIRROR_SYNC1 0x5A
+#define MIRROR_OP_SIZE    'S' // u16 width, u16 height, starts every frame
+#define MIRROR_OP_WINDOW  'W' // u16 x0, y0, x1, y1, pixels fill it row by row
+#define MIRROR_OP_SKIP    'A' // u32 pixels of the window sent in an earlier frame
+#define MIRROR_OP_RUN     'R' // u16 count, u16 pixel
+#define MIRROR_OP_LITERAL 'L' // u16 count, count RGB565 pixels
+#define MIRROR_OP_MONO    'M' // u08 count, u16 color, u16 bgcolor, u32 bits MSB first
+#define MIRROR_OP_AGAIN   'D' // u16 bytes, u16 times: replay the `bytes` of ops before it
+
+struct st7789_mirror_stats {
+    u32 frames;   // frames handed to USB
+    u32 dropped;  // frames lost to backpressure or a missing host
+    u32 skipped;  // windows left out because the viewer already shows them
+    u32 bytes;    // bytes written to USB
+};
+
+// Emitted with the panel as the pointer argument when the viewer missed frames or
+// just connected. Redraw the whole screen on it.
+extern const void* St7789MirrorResyncEvent;
+
+// One panel at a time. Capture runs on whatever core draws, the pump only on core 0.
+void st7789_mirror_start(struct st7789* lcd);
+void st7789_mirror_stop(struct st7789* lcd);
+// Call from the core 0 idle task. Sends what fits into the CDC FIFO and returns
+// TRUE while a frame is half written, nothing else may write to USB until then.
+bool_t st7789_mirror_pump();
+void st7789_mirror_stats(struct st7789_mirror_stats* stats);
+
+// Driver hooks, called by st7789.c for a mirrored instance.
+void st7789_mirror_size(u16 width, u16 height);
+void st7789_mirror_window(u16 x0, u16 y0, u16 x1, u16 y1);
+void st7789_mirror_pixels(const u16* pixels, u32 count);
+void st7789_mirror_repeat(u16 pixel, u32 count);
+void st7789_mirror_mono(u32 bits, u08 count, u16 color, u16 bgcolor);
+
+#endif
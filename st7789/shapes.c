@@ -0,0 +1,168 @@
+#include "shapes.h"
+
+// sin of 0..90 degrees, scaled by 1 << 14
+static const u16 sine_q14[91] = {
+    0, 286, 572, 857, 1143, 1428, 1713, 1997, 2280, 2563,
+    2845, 3126, 3406, 3686, 3964, 4240, 4516, 4790, 5063, 5334,
+    5604, 5872, 6138, 6402, 6664, 6924, 7182, 7438, 7692, 7943,
+    8192, 8438, 8682, 8923, 9162, 9397, 9630, 9860, 10087, 10311,
+    10531, 10749, 10963, 11174, 11381, 11585, 11786, 11982, 12176, 12365,
+    12551, 12733, 12911, 13085, 13255, 13421, 13583, 13741, 13894, 14044,
+    14189, 14330, 14466, 14598, 14726, 14849, 14968, 15082, 15191, 15296,
+    15396, 15491, 15582, 15668, 15749, 15826, 15897, 15964, 16026, 16083,
+    16135, 16182, 16225, 16262, 16294, 16322, 16344, 16362, 16374, 16382,
+    16384,
+};
+
+s16 st7789_sin(s16 degrees) {
+    s32 d = degrees % 360;
+    if(d < 0) d += 360;
+    if(d <= 90) return sine_q14[d];
+    if(d <= 180) return sine_q14[180 - d];
+    if(d <= 270) return -sine_q14[d - 180];
+    return -sine_q14[360 - d];
+}
+
+s16 st7789_cos(s16 degrees) {
+    return st7789_sin(degrees + 90);
+}
+
+// A rounded rectangle, or the ring between it and the one `t` pixels inside.
+// Circles are the w = h = 2r + 1 case.
+struct shape {
+    s32 x, y;
+    u16 w, h;
+    u16 r, ri; // corner radius of the outer and the inner outline
+    u16 t;     // 0 when filled
+    u08 outer[ST7789_SHAPE_RADIUS_MAX + 1]; // half width of the corner circle per row offset
+    u08 inner[ST7789_SHAPE_RADIUS_MAX + 1];
+    // arcs only, pixels are kept when clockwise of v0 and counterclockwise of v1
+    bool_t sector;
+    bool_t wide; // sweep over 180 degrees, either side of the two rays is enough
+    s32 cx, cy;
+    s32 v0x, v0y, v1x, v1y;
+};
+
+// Midpoint circle, every step gives the extent of one row from each octant.
+static void shape_extents(u08* half, u16 r) {
+    s32 x = r, y = 0, err = 1 - r;
+    while(x >= y) {
+        half[y] = x;
+        half[x] = y; // the last y seen on row x is the widest
+        y++;
+        if(err < 0) {
+            err += 2 * y + 1;
+        } else {
+            x--;
+            err += 2 * (y - x) + 1;
+        }
+    }
+}
+
+static void ST7789_HOT(shape_block)(struct st7789* lcd, s32 x0, s32 y0, s32 x1, s32 y1, u16 color) {
+    if(x0 < 0) x0 = 0;
+    if(y0 < 0) y0 = 0;
+    if(x1 >= lcd->width) x1 = lcd->width - 1;
+    if(y1 >= lcd->height) y1 = lcd->height - 1;
+    if(x0 > x1 || y0 > y1) return;
+    st7789_select_window(lcd, x0, y0, x1, y1);
+    st7789_write_repeat(lcd, color, (u32)(x1 - x0 + 1) * (y1 - y0 + 1));
+}
+
+// Walks the row once with the two cross products updated per pixel and sends
+// every run inside the sector as its own span.
+static void ST7789_HOT(shape_sector_row)(struct st7789* lcd, const struct shape* s, s32 x0, s32 x1, s32 y, u16 color) {
+    if(y < 0 || y >= lcd->height) return;
+    if(x0 < 0) x0 = 0;
+    if(x1 >= lcd->width) x1 = lcd->width - 1;
+    s32 px = x0 - s->cx, py = y - s->cy;
+    s32 c0 = s->v0x * py - s->v0y * px; // > 0 clockwise of v0
+    s32 c1 = px * s->v1y - py * s->v1x; // > 0 counterclockwise of v1
+    s32 run = -1;
+    for(s32 x = x0; x <= x1 + 1; x++, c0 -= s->v0y, c1 += s->v1y) {
+        bool_t in = x <= x1 && (s->wide ? (c0 >= 0 || c1 >= 0) : (c0 >= 0 && c1 >= 0));
+        if(in && run < 0) run = x;
+        if(!in && run >= 0) {
+            shape_block(lcd, run, y, x - 1, y, color);
+            run = -1;
+        }
+    }
+}
+
+static void ST7789_HOT(shape_span)(struct st7789* lcd, const struct shape* s, s32 x0, s32 x1, s32 y0, s32 y1, u16 color) {
+    if(x0 > x1) return;
+    if(!s->sector) {
+        shape_block(lcd, x0, y0, x1, y1, color);
+        return;
+    }
+    for(s32 y = y0; y <= y1; y++) shape_sector_row(lcd, s, x0, x1, y, color);
+}
+
+// Spans of row dy, rows the same distance from the top and the bottom edge match.
+static void ST7789_HOT(shape_row)(struct st7789* lcd, const struct shape* s, u16 dy, s32 y0, s32 y1, u16 color) {
+    u16 d = dy < s->h - 1 - dy ? dy : s->h - 1 - dy;
+    u16 off = d < s->r ? s->r - s->outer[s->r - d] : 0;
+    s32 left = s->x + off;
+    s32 right = s->x + s->w - 1 - off;
+    if(!s->t || d < s->t) {
+        shape_span(lcd, s, left, right, y0, y1, color);
+        return;
+    }
+    u16 id = d - s->t;
+    u16 ioff = s->t + (id < s->ri ? s->ri - s->inner[s->ri - id] : 0);
+    shape_span(lcd, s, left, s->x + ioff - 1, y0, y1, color);
+    shape_span(lcd, s, s->x + s->w - ioff, right, y0, y1, color);
+}
+
+static void shape_draw(struct st7789* lcd, struct shape* s, u16 color) {
+    if(!s->w || !s->h) return;
+    if(s->r > ST7789_SHAPE_RADIUS_MAX) s->r = ST7789_SHAPE_RADIUS_MAX;
+    if(s->r > s->w / 2) s->r = s->w / 2;
+    if(s->r > s->h / 2) s->r = s->h / 2;
+    if(2 * s->t >= s->w || 2 * s->t >= s->h) s->t = 0; // nothing left inside
+    s->ri = s->r > s->t ? s->r - s->t : 0;
+    shape_extents(s->outer, s->r);
+    if(s->t) shape_extents(s->inner, s->ri);
+
+    // rows past the corners and the top and bottom outline all look the same
+    u16 zone = s->r > s->t ? s->r : s->t;
+    if(zone > s->h / 2) zone = s->h / 2;
+    s32 top = s->y, bottom = s->y + s->h - 1;
+    for(u16 dy = 0; dy < zone; dy++) {
+        if(top + dy >= lcd->height || bottom - dy < 0) continue;
+        shape_row(lcd, s, dy, top + dy, top + dy, color);
+        shape_row(lcd, s, s->h - 1 - dy, bottom - dy, bottom - dy, color);
+    }
+    if(s->h > 2 * zone) shape_row(lcd, s, zone, top + zone, bottom - zone, color);
+}
+
+void st7789_draw_rounded_rectangle(struct st7789* lcd, s16 x, s16 y, u16 w, u16 h, u16 r, u16 thickness, u16 color) {
+    struct shape s = {.x = x, .y = y, .w = w, .h = h, .r = r, .t = thickness};
+    shape_draw(lcd, &s, color);
+}
+
+void st7789_draw_circle(struct st7789* lcd, s16 cx, s16 cy, u16 r, u16 thickness, u16 color) {
+    if(r > ST7789_SHAPE_RADIUS_MAX) r = ST7789_SHAPE_RADIUS_MAX;
+    struct shape s = {.x = cx - r, .y = cy - r, .w = 2 * r + 1, .h = 2 * r + 1, .r = r, .t = thickness};
+    shape_draw(lcd, &s, color);
+}
+
+void st7789_draw_arc(struct st7789* lcd, s16 cx, s16 cy, u16 r, u16 thickness, s16 a0, s16 a1, u16 color) {
+    if(r > ST7789_SHAPE_RADIUS_MAX) r = ST7789_SHAPE_RADIUS_MAX;
+    struct shape s = {.x = cx - r, .y = cy - r, .w = 2 * r + 1, .h = 2 * r + 1, .r = r, .t = thickness};
+    s32 sweep = (s32)a1 - a0;
+    if(sweep == 0) return;
+    if(sweep > -360 && sweep < 360) {
+        if(sweep < 0) sweep += 360;
+        // rays in screen coordinates, 0 degrees points up and angles grow clockwise
+        s.sector = TRUE;
+        s.wide = sweep > 180;
+        s.cx = cx;
+        s.cy = cy;
+        s.v0x = st7789_sin(a0);
+        s.v0y = -st7789_cos(a0);
+        s.v1x = st7789_sin(a1);
+        s.v1y = -st7789_cos(a1);
+    }
+    shape_draw(lcd, &s, color);
+}
@@ -0,0 +1,27 @@
+#ifndef _PICO_ST7789_SHAPES_H_
+#define _PICO_ST7789_SHAPES_H_
+
+#include "hardware/spi.h"
+
+#include "st7789.h"
+
+// Circles, arcs and rounded rectangles rasterized into horizontal spans. Corner and
+// circle extents come from the midpoint algorithm, one row offset per entry, and
+// every span goes out as one window plus one st7789_write_repeat burst. Straight
+// parts spanning several rows are merged into one window. Shapes may extend past
+// the panel, they are clipped against the current (rotated) width and height.
+// `thickness` 0 fills the shape, otherwise it is the outline width inwards.
+
+#define ST7789_SHAPE_RADIUS_MAX 255
+
+void st7789_draw_circle(struct st7789* lcd, s16 cx, s16 cy, u16 r, u16 thickness, u16 color);
+void st7789_draw_rounded_rectangle(struct st7789* lcd, s16 x, s16 y, u16 w, u16 h, u16 r, u16 thickness, u16 color);
+// Ring sector from angle a0 clockwise to a1, in degrees clockwise from 12 o'clock.
+// A sweep of 360 or more draws the whole ring.
+void st7789_draw_arc(struct st7789* lcd, s16 cx, s16 cy, u16 r, u16 thickness, s16 a0, s16 a1, u16 color);
+
+// sin and cos of whole degrees, scaled by 1 << 14.
+s16 st7789_sin(s16 degrees);
+s16 st7789_cos(s16 degrees);
+
+#endif
@@ -9,38 +9,75 @@
 
 #include "hardware/gpio.h"
 #include "hardware/spi.h"
+#include "hardware/timer.h"
 
 #include "st7789.h"
+#include "blit.h"
+#include "dlist.h"
+#ifdef DISPLAY_MIRROR
+#include "mirror.h"
+#define ST7789_MIRROR(lcd, call) do { if((lcd)->mirrored) call; } while(0)
+#else
+#define ST7789_MIRROR(lcd, call)
+#endif
 
 #include "consts.c"
 
 #define KHZ 1000UL
 
-static struct st7789_config st7789_cfg;
-static u16 st7789_width;
-static u16 st7789_height;
-static bool_t st7789_data_mode = false;
+void display_enable(struct st7789* lcd, bool on) {
+    gpio_put(lcd->cfg.gpio_bl, on);
+}
+
+#define ST7789_BURST 32 // pixels staged on the stack per SPI burst
+#define ST7789_GLYPH_PIXELS (16 * 26) // largest font in font.c
+
+static void ST7789_HOT(st7789_spi_bits)(struct st7789* lcd, u08 bits) {
+    if(lcd->spi_bits == bits) return;
+    spi_set_format(lcd->cfg.spi, bits, SPI_CPOL_1, SPI_CPHA_1, SPI_MSB_FIRST);
+    lcd->spi_bits = bits;
+}
 
-void display_enable(bool on) {
-    gpio_put(st7789_cfg.gpio_bl, on);
+// Every byte for the panel goes through these two, tx_bytes counts them.
+static int ST7789_HOT(st7789_spi_write)(struct st7789* lcd, const u08* data, size_t len) {
+    lcd->tx_bytes += len;
+    return spi_write_blocking(lcd->cfg.spi, data, len);
 }
 
-static void st7789_cmd(u08 cmd, const u08* data, BaseSize_t len) {
-    spi_set_format(st7789_cfg.spi, 8, SPI_CPOL_1, SPI_CPHA_1, SPI_MSB_FIRST);
-    st7789_data_mode = false;
+static int ST7789_HOT(st7789_spi_write16)(struct st7789* lcd, const u16* data, size_t count) {
+    lcd->tx_bytes += count * 2;
+    return spi_write16_blocking(lcd->cfg.spi, data, count);
+}
+
+// RGB444 sends two pixels in three bytes. A span with an odd number of pixels
+// leaves the blue nibble of its last pixel pending: the next span completes the
+// byte, or the next command flushes it padded with four bits the panel drops.
+static void ST7789_HOT(st7789_flush_half)(struct st7789* lcd) {
+    if(!lcd->half_pending) return;
+    u08 last = lcd->half << 4;
+    st7789_spi_write(lcd, &last, 1);
+    lcd->half_pending = false;
+}
 
-    gpio_put(st7789_cfg.gpio_dc, 0);
-    while(!spi_is_writable(st7789_cfg.spi));
-    spi_write_blocking(st7789_cfg.spi, &cmd, sizeof(cmd));
-    gpio_put(st7789_cfg.gpio_dc, 1);
+static void ST7789_HOT(st7789_cmd)(struct st7789* lcd, u08 cmd, const u08* data, BaseSize_t len) {
+    if(lcd->dlist_busy) st7789_dlist_wait(lcd);
+    st7789_flush_half(lcd);
+    st7789_spi_bits(lcd, 8);
+    lcd->data_mode = false;
+
+    gpio_put(lcd->cfg.gpio_dc, 0);
+    lcd->tx_cmds++;
+    while(!spi_is_writable(lcd->cfg.spi));
+    st7789_spi_write(lcd, &cmd, sizeof(cmd));
+    gpio_put(lcd->cfg.gpio_dc, 1);
     
     if (len && data != NULL) {    
-        while(!spi_is_writable(st7789_cfg.spi));        
-        spi_write_blocking(st7789_cfg.spi, data, len);
+        while(!spi_is_writable(lcd->cfg.spi));        
+        st7789_spi_write(lcd, data, len);
     }
 }
 
-static void st7789_caset(u16 xs, u16 xe) {
+static void ST7789_HOT(st7789_caset)(struct st7789* lcd, u16 xs, u16 xe) {
     u08 data[] = {
         xs >> 8,
         xs & 0xff,
@@ -49,10 +86,10 @@ static void st7789_caset(u16 xs, u16 xe) {
     };
 
     // CASET (2Ah): Column Address Set
-    st7789_cmd(ST7789_CASET, data, sizeof(data));
+    st7789_cmd(lcd, ST7789_CASET, data, sizeof(data));
 }
 
-static void st7789_raset(u16 ys, u16 ye){
+static void ST7789_HOT(st7789_raset)(struct st7789* lcd, u16 ys, u16 ye){
     u08 data[] = {
         ys >> 8,
         ys & 0xff,
@@ -61,64 +98,45 @@ static void st7789_raset(u16 ys, u16 ye){
     };
 
     // RASET (2Bh): Row Address Set
-    st7789_cmd(ST7789_RASET, data, sizeof(data));
+    st7789_cmd(lcd, ST7789_RASET, data, sizeof(data));
 }
 
-static void st7789_ramwr(){
-    gpio_put(st7789_cfg.gpio_dc, 0);
+static void ST7789_HOT(st7789_ramwr)(struct st7789* lcd){
+    gpio_put(lcd->cfg.gpio_dc, 0);
 
     u08 cmd = ST7789_RAMWR;
-    while(!spi_is_writable(st7789_cfg.spi));  
-    spi_write_blocking(st7789_cfg.spi, &cmd, sizeof(cmd));
-    gpio_put(st7789_cfg.gpio_dc, 1);
+    lcd->tx_cmds++;
+    while(!spi_is_writable(lcd->cfg.spi));  
+    st7789_spi_write(lcd, &cmd, sizeof(cmd));
+    gpio_put(lcd->cfg.gpio_dc, 1);
 }
 
-void st7789_init(const struct st7789_config* config, u16 width, u16 height) {
-    memcpy(&st7789_cfg, config, sizeof(st7789_cfg));
-    st7789_width = width;
-    st7789_height = height;
-
-    gpio_set_function(st7789_cfg.gpio_din, GPIO_FUNC_SPI);
-    gpio_set_function(st7789_cfg.gpio_clk, GPIO_FUNC_SPI);
-
-    gpio_init(st7789_cfg.gpio_dc);
-    gpio_init(st7789_cfg.gpio_rst);
-    gpio_init(st7789_cfg.gpio_bl);
-
-    gpio_set_dir(st7789_cfg.gpio_dc, GPIO_OUT);
-    gpio_set_dir(st7789_cfg.gpio_rst, GPIO_OUT);
-    gpio_set_dir(st7789_cfg.gpio_bl, GPIO_OUT);
-
-    gpio_put(st7789_cfg.gpio_rst, 0);
-    sleep_ms(250);
-    gpio_put(st7789_cfg.gpio_rst, 1);
-    sleep_ms(250);
-    
-    gpio_put(st7789_cfg.gpio_dc, 1);
-    sleep_ms(150);
-    
-    spi_init(st7789_cfg.spi, st7789_cfg.clk_perif_khz * KHZ / 100);
-    spi_set_format(st7789_cfg.spi, 8, SPI_CPOL_1, SPI_CPHA_1, SPI_MSB_FIRST);
-    sleep_ms(150);
-
-    // SWRESET (01h): Software Reset
-    st7789_cmd(ST7789_SWRESET, NULL, 0);
-    sleep_ms(150);
-
-    // SLPOUT (11h): Sleep Out
-    st7789_cmd(ST7789_SLPOUT, NULL, 0);
-    sleep_ms(150);
-
+typedef enum {
+    ST7789_STEP_RESET,   // pull RESX low
+    ST7789_STEP_RELEASE, // release RESX
+    ST7789_STEP_CMD
+} st7789_step_kind;
+
+typedef struct st7789_step {
+    u08 kind;
+    u08 cmd;
+    u08 len;
+    u08 data[1];
+    u16 delay_ms; // datasheet minimum before the next step
+} st7789_step;
+
+static const st7789_step st7789_init_sequence[] = {
+    // RESX low pulse must be at least 10 us
+    { ST7789_STEP_RESET,   0, 0, {0}, 1 },
+    // 5 ms after reset before any command, 120 ms before SLPOUT
+    { ST7789_STEP_RELEASE, 0, 0, {0}, 120 },
+    // SLPOUT (11h): Sleep Out, 5 ms before the next command
+    { ST7789_STEP_CMD, ST7789_SLPOUT, 0, {0}, 5 },
     // COLMOD (3Ah): Interface Pixel Format
     // - RGB interface color format     = 65K of RGB interface
     // - Control interface color format = 16bit/pixel
-    st7789_cmd(
-        ST7789_COLMOD, 
-        (u08[]){ ST7789_COLOR_MODE_65K | ST7789_COLOR_MODE_16BIT }, 
-        1
-    );
-    sleep_ms(150);
-
+    // - 12bit/pixel instead when the instance is configured for RGB444
+    { ST7789_STEP_CMD, ST7789_COLMOD, 1, { ST7789_COLOR_MODE_65K | ST7789_COLOR_MODE_16BIT }, 0 },
     // MADCTL (36h): Memory Data Access Control
     // - Page Address Order            = Top to Bottom
     // - Column Address Order          = Left to Right
@@ -126,86 +144,372 @@ void st7789_init(const struct st7789_config* config, u16 width, u16 height) {
     // - Line Address Order            = LCD Refresh Top to Bottom
     // - RGB/BGR Order                 = RGB
     // - Display Data Latch Data Order = LCD Refresh Left to Right
-    st7789_cmd(ST7789_MADCTL, (u08[]){ ST7789_MADCTL_RGB }, 1);
-    sleep_ms(150);
-
+    { ST7789_STEP_CMD, ST7789_MADCTL, 1, { ST7789_MADCTL_RGB }, 0 },
     // INVON (21h): Display Inversion On
-    st7789_cmd(ST7789_INVON, NULL, 0);
-    sleep_ms(150);
-
+    { ST7789_STEP_CMD, ST7789_INVON,  0, {0}, 0 },
     // NORON (13h): Normal Display Mode On
-    st7789_cmd(ST7789_NORON, NULL, 0);
-    sleep_ms(150);
+    { ST7789_STEP_CMD, ST7789_NORON,  0, {0}, 0 },
+    // DISPON (29h): Main screen turned on
+    { ST7789_STEP_CMD, ST7789_DISPON, 0, {0}, 0 },
+};
 
+// Registers and frame memory survive sleep, so waking up only needs SLPOUT.
+static const st7789_step st7789_wake_sequence[] = {
+    // SLPOUT (11h): Sleep Out, 5 ms before the next command
+    { ST7789_STEP_CMD, ST7789_SLPOUT, 0, {0}, 5 },
     // DISPON (29h): Main screen turned on
-    st7789_cmd(ST7789_DISPON, NULL, 0);
-    sleep_ms(150);
+    { ST7789_STEP_CMD, ST7789_DISPON, 0, {0}, 0 },
+};
+
+#define ST7789_STEPS(seq) (sizeof(seq)/sizeof(seq[0]))
+#define ST7789_SLEEP_MIN_US 120000 // SLPIN to SLPOUT
+#define ST7789_GRAM_ROWS 320 // gate lines of the controller, 240x240 glass uses the first 240
+
+static Time_t st7789_ms_to_ticks(u16 ms) {
+    // round up and add one tick, the first tick of a timer may be partial
+    return (ms * TICK_PER_SECOND + 999) / 1000 + 1;
+}
+
+static void st7789_sequence_task(BaseSize_t step, BaseParam_t arg_p) {
+    struct st7789* lcd = (struct st7789*)arg_p;
+    while(step < lcd->seq_len) {
+        const st7789_step* s = &lcd->seq[step++];
+        switch(s->kind) {
+            case ST7789_STEP_RESET:
+                gpio_put(lcd->cfg.gpio_rst, 0);
+                break;
+            case ST7789_STEP_RELEASE:
+                gpio_put(lcd->cfg.gpio_rst, 1);
+                break;
+            default:
+                if(s->cmd == ST7789_COLMOD && lcd->cfg.pixel_format == ST7789_FORMAT_RGB444) {
+                    st7789_cmd(lcd, s->cmd, (u08[]){ ST7789_COLOR_MODE_65K | ST7789_COLOR_MODE_12BIT }, 1);
+                    break;
+                }
+                st7789_cmd(lcd, s->cmd, s->len ? s->data : NULL, s->len);
+                break;
+        }
+        if(s->delay_ms) {
+            SetTimerTask(st7789_sequence_task, step, arg_p, st7789_ms_to_ticks(s->delay_ms));
+            return;
+        }
+    }
 
-    st7789_caset(0, width);
-    st7789_raset(0, height);
+    if(lcd->seq == st7789_init_sequence) {
+        st7789_caset(lcd, 0, lcd->width);
+        st7789_raset(lcd, 0, lcd->height);
 
-    display_enable(false);
+        display_enable(lcd, false);
 
-    spi_set_baudrate(st7789_cfg.spi, st7789_cfg.clk_perif_khz * KHZ);
+        spi_set_baudrate(lcd->cfg.spi, lcd->cfg.clk_perif_khz * KHZ);
+    }
+    lcd->ready_us = time_us_64() - lcd->seq_us;
+    lcd->ready = true;
+    emitSignal(St7789ReadyEvent, 0, lcd);
 }
 
-void st7789_write(const void* data, BaseSize_t len) {
-    if (!st7789_data_mode) {
-        st7789_ramwr();
-        spi_set_format(st7789_cfg.spi, 16, SPI_CPOL_1, SPI_CPHA_1, SPI_MSB_FIRST);
-        st7789_data_mode = true;
+const void* St7789ReadyEvent = (void*)st7789_sequence_task;
+
+bool_t st7789_is_ready(struct st7789* lcd) {
+    return lcd->ready;
+}
+
+void st7789_init(struct st7789* lcd, const struct st7789_config* config, u16 width, u16 height) {
+    lcd->seq_us = time_us_64();
+    memcpy(&lcd->cfg, config, sizeof(lcd->cfg));
+    lcd->data_mode = false;
+    lcd->half_pending = false;
+    lcd->width = width;
+    lcd->height = height;
+    lcd->ready = false;
+    lcd->mirrored = false;
+    lcd->dlist_busy = false;
+    lcd->tx_bytes = 0;
+    lcd->tx_cmds = 0;
+    lcd->tx_pixels = 0;
+    lcd->blend_count = 0;
+    lcd->blend_misses = 0;
+
+    gpio_set_function(lcd->cfg.gpio_din, GPIO_FUNC_SPI);
+    gpio_set_function(lcd->cfg.gpio_clk, GPIO_FUNC_SPI);
+
+    gpio_init(lcd->cfg.gpio_dc);
+    gpio_init(lcd->cfg.gpio_rst);
+    gpio_init(lcd->cfg.gpio_bl);
+
+    gpio_set_dir(lcd->cfg.gpio_dc, GPIO_OUT);
+    gpio_set_dir(lcd->cfg.gpio_rst, GPIO_OUT);
+    gpio_set_dir(lcd->cfg.gpio_bl, GPIO_OUT);
+
+    gpio_put(lcd->cfg.gpio_rst, 1);
+    gpio_put(lcd->cfg.gpio_dc, 1);
+
+    spi_init(lcd->cfg.spi, lcd->cfg.clk_perif_khz * KHZ / 100);
+    spi_set_format(lcd->cfg.spi, 8, SPI_CPOL_1, SPI_CPHA_1, SPI_MSB_FIRST);
+    lcd->spi_bits = 8;
+
+    lcd->sleeping = false;
+    lcd->madctl = ST7789_MADCTL_RGB;
+    lcd->seq = st7789_init_sequence;
+    lcd->seq_len = ST7789_STEPS(st7789_init_sequence);
+    SetTask(st7789_sequence_task, 0, lcd);
+}
+
+void st7789_set_clk_perif(struct st7789* lcd, u32 clk_perif_khz) {
+    lcd->cfg.clk_perif_khz = clk_perif_khz;
+    if(lcd->cfg.spi != NULL) spi_set_baudrate(lcd->cfg.spi, clk_perif_khz * KHZ);
+}
+
+void st7789_wait_idle(struct st7789* lcd) {
+    if(lcd->dlist_busy) st7789_dlist_wait(lcd);
+    if(lcd->cfg.spi != NULL) while(spi_is_busy(lcd->cfg.spi));
+}
+
+static void ST7789_HOT(st7789_begin_data)(struct st7789* lcd) {
+    if(lcd->dlist_busy) st7789_dlist_wait(lcd);
+    if (!lcd->data_mode) {
+        st7789_ramwr(lcd);
+        lcd->data_mode = true;
     }
-    while(!spi_is_writable(st7789_cfg.spi));
+    st7789_spi_bits(lcd, lcd->cfg.pixel_format == ST7789_FORMAT_RGB444 ? 8 : 16);
+}
+
+static inline u16 st7789_rgb444(u16 pixel) {
+    return ((pixel >> 4) & 0xF00) | ((pixel >> 3) & 0x0F0) | ((pixel >> 1) & 0x00F);
+}
+
+static void ST7789_HOT(st7789_write444)(struct st7789* lcd, const u16* pixels, u32 count) {
+    u08 buf[ST7789_BURST * 3 / 2 + 2];
+    u32 n = 0;
+    while(count--) {
+        u16 p = st7789_rgb444(*pixels++);
+        if(!lcd->half_pending) {
+            buf[n++] = p >> 4;
+            lcd->half = p & 0x0F;
+            lcd->half_pending = true;
+        } else {
+            buf[n++] = (lcd->half << 4) | (p >> 8);
+            buf[n++] = p & 0xFF;
+            lcd->half_pending = false;
+        }
+        if(n >= sizeof(buf) - 2) {
+            st7789_spi_write(lcd, buf, n);
+            n = 0;
+        }
+    }
+    if(n) st7789_spi_write(lcd, buf, n);
+}
+
+static void ST7789_HOT(st7789_repeat444)(struct st7789* lcd, u16 pixel, u32 count) {
+    if(lcd->half_pending && count) {
+        st7789_write444(lcd, &pixel, 1);
+        count--;
+    }
+    u16 p = st7789_rgb444(pixel);
+    u08 buf[ST7789_BURST * 3 / 2];
+    for(u08 i = 0; i < sizeof(buf); i += 3) {
+        buf[i] = p >> 4;
+        buf[i + 1] = ((p & 0x0F) << 4) | (p >> 8);
+        buf[i + 2] = p & 0xFF;
+    }
+    for(u32 pairs = count >> 1; pairs;) {
+        u32 chunk = pairs < ST7789_BURST / 2 ? pairs : ST7789_BURST / 2;
+        st7789_spi_write(lcd, buf, chunk * 3);
+        pairs -= chunk;
+    }
+    if(count & 1) st7789_write444(lcd, &pixel, 1);
+}
+
+static void ST7789_HOT(st7789_mono444)(struct st7789* lcd, u32 bits, u08 count, u16 color, u16 bgcolor) {
+    u16 fg = st7789_rgb444(color);
+    u16 bg = st7789_rgb444(bgcolor);
+    u08 pairs[4][3];
+    for(u08 i = 0; i < 4; i++) {
+        u16 p0 = (i & 2) ? fg : bg;
+        u16 p1 = (i & 1) ? fg : bg;
+        pairs[i][0] = p0 >> 4;
+        pairs[i][1] = ((p0 & 0x0F) << 4) | (p1 >> 8);
+        pairs[i][2] = p1 & 0xFF;
+    }
+    if(lcd->half_pending && count) {
+        st7789_write444(lcd, (bits & 0x80000000) ? &color : &bgcolor, 1);
+        bits <<= 1;
+        count--;
+    }
+    u08 buf[ST7789_BURST * 3 / 2];
+    u08 n = 0;
+    for(; count >= 2; count -= 2, bits <<= 2) {
+        const u08* pair = pairs[bits >> 30];
+        buf[n++] = pair[0];
+        buf[n++] = pair[1];
+        buf[n++] = pair[2];
+    }
+    if(n) st7789_spi_write(lcd, buf, n);
+    if(count) st7789_write444(lcd, (bits & 0x80000000) ? &color : &bgcolor, 1);
+}
+
+void ST7789_HOT(st7789_write)(struct st7789* lcd, const void* data, BaseSize_t len) {
+    ST7789_MIRROR(lcd, st7789_mirror_pixels(data, len >> 1));
+    st7789_begin_data(lcd);
+    lcd->tx_pixels += len >> 1;
+    if(lcd->cfg.pixel_format == ST7789_FORMAT_RGB444) {
+        st7789_write444(lcd, data, len >> 1);
+        return;
+    }
+    while(!spi_is_writable(lcd->cfg.spi));
     BaseSize_t n = 0;
-    if(len > 1) n = (spi_write16_blocking(st7789_cfg.spi, data, len>>1))<<1;
+    if(len > 1) n = (st7789_spi_write16(lcd, data, len>>1))<<1;
     if( n != len ) {
-        spi_set_format(st7789_cfg.spi, 8, SPI_CPOL_1, SPI_CPHA_1, SPI_MSB_FIRST);
-        spi_write_blocking(st7789_cfg.spi, data+n, 1);
+        st7789_spi_bits(lcd, 8);
+        st7789_spi_write(lcd, (const u08*)data+n, 1);
     }
 }
 
-void st7789_put(u16 pixel) {
-    st7789_write(&pixel, sizeof(pixel));
+void ST7789_HOT(st7789_write_pixels)(struct st7789* lcd, const u16* pixels, u32 count) {
+    ST7789_MIRROR(lcd, st7789_mirror_pixels(pixels, count));
+    st7789_begin_data(lcd);
+    lcd->tx_pixels += count;
+    if(lcd->cfg.pixel_format == ST7789_FORMAT_RGB444) st7789_write444(lcd, pixels, count);
+    else st7789_spi_write16(lcd, pixels, count);
 }
 
-void st7789_fill(u16 pixel) {
-    int num_pixels = st7789_width * st7789_height;
+void ST7789_HOT(st7789_write_repeat)(struct st7789* lcd, u16 pixel, u32 count) {
+    ST7789_MIRROR(lcd, st7789_mirror_repeat(pixel, count));
+    st7789_begin_data(lcd);
+    lcd->tx_pixels += count;
+    if(lcd->cfg.pixel_format == ST7789_FORMAT_RGB444) {
+        st7789_repeat444(lcd, pixel, count);
+        return;
+    }
+    u16 buf[ST7789_BURST];
+    for(u08 i = 0; i < ST7789_BURST; i++) buf[i] = pixel;
+    while(count) {
+        u32 chunk = count < ST7789_BURST ? count : ST7789_BURST;
+        st7789_spi_write16(lcd, buf, chunk);
+        count -= chunk;
+    }
+}
 
-    st7789_set_cursor(0, 0);
+void ST7789_HOT(st7789_write_mono)(struct st7789* lcd, u32 bits, u08 count, u16 color, u16 bgcolor) {
+    ST7789_MIRROR(lcd, st7789_mirror_mono(bits, count, color, bgcolor));
+    st7789_begin_data(lcd);
+    lcd->tx_pixels += count;
+    if(lcd->cfg.pixel_format == ST7789_FORMAT_RGB444) {
+        st7789_mono444(lcd, bits, count, color, bgcolor);
+        return;
+    }
+    u16 line[32];
+    for(u08 i = 0; i < count; i++, bits <<= 1) {
+        line[i] = (bits & 0x80000000) ? color : bgcolor;
+    }
+    st7789_spi_write16(lcd, line, count);
+}
 
-    for (int i = 0; i < num_pixels; i++) {
-        st7789_put(pixel);
+void ST7789_HOT(st7789_put)(struct st7789* lcd, u16 pixel) {
+    st7789_write_pixels(lcd, &pixel, 1);
+}
+
+void st7789_fill(struct st7789* lcd, u16 pixel) {
+    st7789_set_cursor(lcd, 0, 0);
+    st7789_write_repeat(lcd, pixel, (u32)lcd->width * lcd->height);
+}
+
+void st7789_invert_colors(struct st7789* lcd, bool_t invert) {
+    if(invert) st7789_cmd(lcd, ST7789_INVON, NULL, 0);
+    else  st7789_cmd(lcd, ST7789_INVOFF, NULL, 0);
+}
+
+void st7789_set_cursor(struct st7789* lcd, u16 x, u16 y) {
+    st7789_select_window(lcd, x, y, lcd->width, lcd->height);
+}
+
+void ST7789_HOT(st7789_select_window)(struct st7789* lcd, u16 x0, u16 y0, u16 x1, u16 y1) {
+    ST7789_MIRROR(lcd, st7789_mirror_window(x0, y0, x1, y1));
+    st7789_caset(lcd, x0, x1);
+    st7789_raset(lcd, y0, y1);
+}
+
+void st7789_partial_mode(struct st7789* lcd, u16 start_line, u16 end_line) {
+    u08 data[] = {
+        start_line >> 8,
+        start_line & 0xff,
+        end_line >> 8,
+        end_line & 0xff,
+    };
+    // PTLAR (30h): Partial Area, then PTLON (12h): Partial Display Mode On
+    st7789_cmd(lcd, ST7789_PTLAR, data, sizeof(data));
+    st7789_cmd(lcd, ST7789_PTLON, NULL, 0);
+}
+
+bool_t st7789_partial_band(struct st7789* lcd, u16 x0, u16 y0, u16 x1, u16 y1) {
+    // partial mode works on gate lines, they run along screen columns when MV exchanges rows and columns
+    bool_t exchanged = (lcd->madctl & ST7789_MADCTL_MV) != 0;
+    u16 first = exchanged ? x0 : y0;
+    u16 last = exchanged ? x1 : y1;
+    u16 lines = exchanged ? lcd->width : lcd->height;
+    if(first > last || (first == 0 && last >= lines - 1)) return false;
+    if(lcd->madctl & ST7789_MADCTL_MY) {
+        // MY reverses the gate order in every rotation, over all 320 lines of the
+        // controller. st7789_raset adds no row offset, so nothing is taken off.
+        u16 top = ST7789_GRAM_ROWS - 1 - last;
+        last = ST7789_GRAM_ROWS - 1 - first;
+        first = top;
     }
+    st7789_partial_mode(lcd, first, last);
+    return true;
+}
+
+void st7789_normal_mode(struct st7789* lcd) {
+    // NORON (13h): Normal Display Mode On, leaves partial mode
+    st7789_cmd(lcd, ST7789_NORON, NULL, 0);
 }
 
-void st7789_invert_colors(bool_t invert) {
-    if(invert) st7789_cmd(ST7789_INVON, NULL, 0);
-    else  st7789_cmd(ST7789_INVOFF, NULL, 0);
+void st7789_idle_mode(struct st7789* lcd, bool_t on) {
+    // IDMON (39h) / IDMOFF (38h): 8 color mode for lower power
+    st7789_cmd(lcd, on ? ST7789_IDMON : ST7789_IDMOFF, NULL, 0);
 }
 
-void st7789_set_cursor(u16 x, u16 y) {
-    st7789_select_window(x, y, st7789_width, st7789_height);
+void st7789_sleep(struct st7789* lcd) {
+    if(lcd->sleeping) return;
+    // DISPOFF (28h) then SLPIN (10h), frame memory and registers are kept
+    st7789_cmd(lcd, ST7789_DISPOFF, NULL, 0);
+    st7789_cmd(lcd, ST7789_SLPIN, NULL, 0);
+    lcd->sleep_us = time_us_64();
+    lcd->sleeping = true;
 }
 
-void st7789_select_window(u16 x0, u16 y0, u16 x1, u16 y1) {
-    st7789_caset(x0, x1);
-    st7789_raset(y0, y1);
+void st7789_wake(struct st7789* lcd) {
+    if(!lcd->sleeping) {
+        emitSignal(St7789ReadyEvent, 0, lcd);
+        return;
+    }
+    lcd->seq_us = time_us_64();
+    lcd->sleeping = false;
+    lcd->ready = false;
+    lcd->seq = st7789_wake_sequence;
+    lcd->seq_len = ST7789_STEPS(st7789_wake_sequence);
+    uint64_t asleep = time_us_64() - lcd->sleep_us;
+    if(asleep >= ST7789_SLEEP_MIN_US) {
+        SetTask(st7789_sequence_task, 0, lcd);
+        return;
+    }
+    SetTimerTask(st7789_sequence_task, 0, lcd, st7789_ms_to_ticks((ST7789_SLEEP_MIN_US - asleep + 999) / 1000));
 }
 
-void st7789_vertical_scroll(u16 row) {
+void st7789_vertical_scroll(struct st7789* lcd, u16 row) {
     u08 data[] = {
         (row >> 8) & 0xff,
         row & 0x00ff
     };
     // VSCSAD (37h): Vertical Scroll Start Address of RAM 
-    st7789_cmd(ST7789_VSCSAD, data, sizeof(data));
+    st7789_cmd(lcd, ST7789_VSCSAD, data, sizeof(data));
 }
 
 /**
  * Rotate the display clockwise or anti-clockwie set by `rotation`
  * @param rotation Type of rotation. Supported values 0, 1, 2, 3
  */
-void st7789_rotate_display(u08 rotation) {
+void st7789_rotate_display(struct st7789* lcd, u08 rotation) {
 	/*
 	* 	(u08)rotation :	Rotation Type
 	* 					0 : Default landscape
@@ -219,54 +523,121 @@ void st7789_rotate_display(u08 rotation) {
 	switch (rotation)
 	{
 		case 0:
-			st7789_cmd(ST7789_MADCTL, (u08[]){ST7789_MADCTL_RGB}, 1);	// Default
-            temp_width = (u16)st7789_width;
-            st7789_width = st7789_height;
-			st7789_height = temp_width;
+			lcd->madctl = ST7789_MADCTL_RGB;
+			st7789_cmd(lcd, ST7789_MADCTL, &lcd->madctl, 1);	// Default
+            temp_width = (u16)lcd->width;
+            lcd->width = lcd->height;
+			lcd->height = temp_width;
 			break;
 		case 1:
-			st7789_cmd(ST7789_MADCTL, (u08[]){ ST7789_MADCTL_MX | ST7789_MADCTL_MY | ST7789_MADCTL_RGB }, 1);
-            temp_width = (u16)st7789_width;
-            st7789_width = st7789_height;
-			st7789_height = temp_width;
+			lcd->madctl = ST7789_MADCTL_MX | ST7789_MADCTL_MY | ST7789_MADCTL_RGB;
+			st7789_cmd(lcd, ST7789_MADCTL, &lcd->madctl, 1);
+            temp_width = (u16)lcd->width;
+            lcd->width = lcd->height;
+			lcd->height = temp_width;
 			break;
 		case 2:
-			st7789_cmd(ST7789_MADCTL, (u08[]){ ST7789_MADCTL_MY | ST7789_MADCTL_MV | ST7789_MADCTL_RGB }, 1);
-            temp_width = (u16)st7789_width;
-			st7789_width = st7789_height;
-			st7789_height = temp_width;
+			lcd->madctl = ST7789_MADCTL_MY | ST7789_MADCTL_MV | ST7789_MADCTL_RGB;
+			st7789_cmd(lcd, ST7789_MADCTL, &lcd->madctl, 1);
+            temp_width = (u16)lcd->width;
+			lcd->width = lcd->height;
+			lcd->height = temp_width;
 			break;
 		case 3:
-			st7789_cmd(ST7789_MADCTL, (u08[]){ ST7789_MADCTL_MX | ST7789_MADCTL_MV | ST7789_MADCTL_RGB }, 1);
-            temp_width = (u16)st7789_width;
-            st7789_width = st7789_height;
-			st7789_height = temp_width;
+			lcd->madctl = ST7789_MADCTL_MX | ST7789_MADCTL_MV | ST7789_MADCTL_RGB;
+			st7789_cmd(lcd, ST7789_MADCTL, &lcd->madctl, 1);
+            temp_width = (u16)lcd->width;
+            lcd->width = lcd->height;
+			lcd->height = temp_width;
 			break;
 	}
+	ST7789_MIRROR(lcd, st7789_mirror_size(lcd->width, lcd->height));
 }
 
-static void st7789_write_char(u16 x, u16 y, char ch, FontDef font, u16 color, u16 bgcolor){
-    st7789_select_window(x,y, x + font.width - 1, y + font.height - 1);
-    
-	for (u32 i = 0; i < font.height; i++) {
-		u32 b = font.data[(ch - 32) * font.height + i];
-		for (u32 j = 0; j < font.width; j++) {
-			if ((b << j) & 0x8000) {
-				st7789_write(&color, sizeof(color));
-			}
-			else {
-				st7789_write(&bgcolor, sizeof(bgcolor));
-			}
-		}
-	}
+static void ST7789_HOT(st7789_write_char)(struct st7789* lcd, u16 x, u16 y, char ch, FontDef font, u16 color, u16 bgcolor){
+    u16 glyph[ST7789_GLYPH_PIXELS + 16];
+    st7789_select_window(lcd, x,y, x + font.width - 1, y + font.height - 1);
+    blit_glyph(glyph, &font.data[(ch - 32) * font.height], font.width, font.height, color, bgcolor);
+    st7789_write_pixels(lcd, glyph, (u32)font.width * font.height);
+}
+
+static u16 st7789_mix(u16 color, u16 bgcolor, u08 alpha) {
+    u16 r = ((color >> 11) * alpha + (bgcolor >> 11) * (15 - alpha) + 7) / 15;
+    u16 g = (((color >> 5) & 0x3F) * alpha + ((bgcolor >> 5) & 0x3F) * (15 - alpha) + 7) / 15;
+    u16 b = ((color & 0x1F) * alpha + (bgcolor & 0x1F) * (15 - alpha) + 7) / 15;
+    return r << 11 | g << 5 | b;
+}
+
+// The UI draws with a handful of color pairs, so a few tables kept in most
+// recently used order are enough to build one only when the colors change.
+static const u16* st7789_blend_table(struct st7789* lcd, u16 color, u16 bgcolor) {
+    u08 i = 0;
+    while(i < lcd->blend_count && (lcd->blend[i].color != color || lcd->blend[i].bgcolor != bgcolor)) i++;
+    if(i == 0 && lcd->blend_count) return lcd->blend[0].px;
+    struct st7789_blend entry;
+    if(i < lcd->blend_count) {
+        entry = lcd->blend[i];
+    } else {
+        if(lcd->blend_count < ST7789_BLEND_CACHE) lcd->blend_count++;
+        i = lcd->blend_count - 1; // the least recently used one goes
+        entry.color = color;
+        entry.bgcolor = bgcolor;
+        for(u08 alpha = 0; alpha < 16; alpha++) entry.px[alpha] = st7789_mix(color, bgcolor, alpha);
+        lcd->blend_misses++;
+    }
+    memmove(&lcd->blend[1], &lcd->blend[0], i * sizeof(entry));
+    lcd->blend[0] = entry;
+    return lcd->blend[0].px;
+}
+
+// Rows go out in bursts of as many as fit the glyph buffer, two for the largest fonts.
+static void ST7789_HOT(st7789_write_char_aa)(struct st7789* lcd, u16 x, u16 y, char ch, const FontDef* font, const u16* table){
+    u16 glyph[ST7789_GLYPH_PIXELS + 1];
+    u08 stride = (font->width + 1) >> 1;
+    u08 rows = ST7789_GLYPH_PIXELS / font->width;
+    const u08* src = &font->aa[(u32)(ch - 32) * font->height * stride];
+    st7789_select_window(lcd, x, y, x + font->width - 1, y + font->height - 1);
+    for (u08 row = 0; row < font->height; row += rows) {
+        u08 n = font->height - row < rows ? font->height - row : rows;
+        blit_glyph4(glyph, src + row * stride, font->width, n, table);
+        st7789_write_pixels(lcd, glyph, (u32)font->width * n);
+    }
+}
+
+// Every run of equal source bits becomes one span of run*scale pixels in the line
+// buffer, each expanded line is sent `scale` times and reused while source rows repeat.
+static void ST7789_HOT(st7789_write_char_scaled)(struct st7789* lcd, u16 x, u16 y, char ch, FontDef font, u08 scale, u16 color, u16 bgcolor){
+    u16 line[16 * ST7789_MAX_SCALE];
+    u16 w = font.width * scale;
+    const u16* rows = &font.data[(ch - 32) * font.height];
+    st7789_select_window(lcd, x, y, x + w - 1, y + font.height * scale - 1);
+    for (u08 i = 0; i < font.height; i++) {
+        if (i == 0 || rows[i] != rows[i - 1]) {
+            u16 bits = rows[i];
+            u16* p = line;
+            for (u08 px = 0; px < font.width;) {
+                u16 on = bits & 0x8000;
+                u08 run = 0;
+                for (; px < font.width && (bits & 0x8000) == on; px++, bits <<= 1) run++;
+                u16 c = on ? color : bgcolor;
+                for (u16 k = run * scale; k; k--) *p++ = c;
+            }
+        }
+        for (u08 r = 0; r < scale; r++) st7789_write_pixels(lcd, line, w);
+    }
 }
 
-void st7789_write_string(u16 x, u16 y, const char *str, FontDef font, u16 color, u16 bgcolor) {
+void ST7789_HOT(st7789_write_string)(struct st7789* lcd, u16 x, u16 y, const char *str, FontDef font, u08 scale, u16 color, u16 bgcolor) {
+	if (scale == 0 || font.aa) scale = 1;
+	if (scale > ST7789_MAX_SCALE) scale = ST7789_MAX_SCALE;
+	const u16* table = font.aa ? st7789_blend_table(lcd, color, bgcolor) : NULL;
+	u16 width = font.width * scale;
+	u16 height = font.height * scale;
 	while (*str) {
-		if (x + font.width >= st7789_width) {
+		if (x + width >= lcd->width) {
 			x = 0;
-			y += font.height;
-			if (y + font.height >= st7789_height) {
+			y += height;
+			if (y + height >= lcd->height) {
 				break;
 			}
 
@@ -276,13 +647,15 @@ void st7789_write_string(u16 x, u16 y, const char *str, FontDef font, u16 color,
 				continue;
 			}
 		}
-		st7789_write_char(x, y, *str, font, color, bgcolor);
-		x += font.width;
+		if (table) st7789_write_char_aa(lcd, x, y, *str, &font, table);
+		else if (scale == 1) st7789_write_char(lcd, x, y, *str, font, color, bgcolor);
+		else st7789_write_char_scaled(lcd, x, y, *str, font, scale, color, bgcolor);
+		x += width;
 		str++;
 	}
 }
 
-void st7789_draw_line(u16 x0, u16 y0, u16 x1, u16 y1, u16 color) {
+void ST7789_HOT(st7789_draw_line)(struct st7789* lcd, u16 x0, u16 y0, u16 x1, u16 y1, u16 color) {
 	u16 swap;
     u16 steep = ABS(y1 - y0) > ABS(x1 - x0);
 
@@ -316,9 +689,9 @@ void st7789_draw_line(u16 x0, u16 y0, u16 x1, u16 y1, u16 color) {
     else ystep = -1;
 
     for (; x0<=x1; x0++) {
-        if (steep) st7789_select_window(y0, x0, y0, x0);
-        else st7789_select_window(x0, y0, x0, y0);
-        st7789_put(color);
+        if (steep) st7789_select_window(lcd, y0, x0, y0, x0);
+        else st7789_select_window(lcd, x0, y0, x0, y0);
+        st7789_put(lcd, color);
         err -= dy;
         if (err < 0) {
             y0 += ystep;
@@ -327,24 +700,21 @@ void st7789_draw_line(u16 x0, u16 y0, u16 x1, u16 y1, u16 color) {
     }
 }
 
-void st7789_draw_filled_rectangle(u16 x, u16 y, u16 w, u16 h, u16 color) {
+void ST7789_HOT(st7789_draw_filled_rectangle)(struct st7789* lcd, u16 x, u16 y, u16 w, u16 h, u16 color) {
 	/* Check input parameters */
-	if (x >= st7789_width || y >= st7789_height) {
+	if (x >= lcd->width || y >= lcd->height || !w || !h) {
 		/* Return error */
 		return;
 	}
 
 	/* Check width and height */
-	if ((x + w) >= st7789_width) {
-		w = st7789_width - x;
+	if ((x + w) > lcd->width) {
+		w = lcd->width - x;
 	}
-	if ((y + h) >= st7789_height) {
-		h = st7789_height - y;
+	if ((y + h) > lcd->height) {
+		h = lcd->height - y;
 	}
 
-	/* Draw lines */
-	for (u16 i = 0; i <= h; i++) {
-		/* Draw lines */
-		st7789_draw_line(x, y + i, x + w, y + i, color);
-	}
+	st7789_select_window(lcd, x, y, x + w - 1, y + h - 1);
+	st7789_write_repeat(lcd, color, (u32)w * h);
 }
@@ -2,6 +2,9 @@
 #ifndef _PICO_ST7789_H_
 #define _PICO_ST7789_H_
 
+#include <stdint.h>
+#include <pico/platform.h>
+
 #include "font.h"
 #include "../femtox/TaskMngr.h"
 
@@ -13,20 +16,104 @@ struct st7789_config {
     u08 gpio_dc;
     u08 gpio_rst;
     u08 gpio_bl;
+    u08 pixel_format; // ST7789_FORMAT_RGB565 or ST7789_FORMAT_RGB444
 };
 
-void display_enable(bool on);
-void st7789_init(const struct st7789_config* config, u16 width, u16 height);
-void st7789_write(const void* data, BaseSize_t len);
-void st7789_put(u16 pixel);
-void st7789_fill(u16 pixel);
-void st7789_select_window(u16 x0, u16 y0, u16 x1, u16 y1);
-void st7789_set_cursor(u16 x, u16 y);
-void st7789_vertical_scroll(u16 row);
-void st7789_rotate_display(u08 rotation); // @param rotation Type of rotation. Supported values 0, 1, 2, 3
-void st7789_write_string(u16 x, u16 y, const char *str, FontDef font, u16 color, u16 bgcolor);
-void st7789_draw_line(u16 x0, u16 y0, u16 x1, u16 y1, u16 color);
-void st7789_draw_filled_rectangle(u16 x, u16 y, u16 w, u16 h, u16 color);
+#define ST7789_FORMAT_RGB565 0 // 16 bits per pixel on the wire
+#define ST7789_FORMAT_RGB444 1 // 12 bits per pixel, two pixels packed in three bytes
+
+#define ST7789_MAX_SCALE 4 // st7789_write_string glyph magnification
+
+// Built with ST7789_RAM_FUNCS the per-pixel loops and the SPI transport run from
+// SRAM, so drawing never waits on a flash fetch behind an XIP cache miss.
+#ifdef ST7789_RAM_FUNCS
+#define ST7789_HOT(name) __not_in_flash_func(name)
+#else
+#define ST7789_HOT(name) name
+#endif
+
+#define ST7789_BLEND_CACHE 4 // color pairs with a ready anti-aliasing table per panel
+
+// Coverage 0..15 of an anti-aliased glyph pixel blended from bgcolor to color.
+struct st7789_blend {
+    u16 color;
+    u16 bgcolor;
+    u16 px[16];
+};
+
+// One panel instance. All driver state lives here, so panels on different
+// SPI blocks can be driven concurrently, e.g. one per core. A single instance
+// must not be used from both cores at the same time.
+struct st7789_step;
+
+struct st7789 {
+    struct st7789_config cfg;
+    u16 width;
+    u16 height;
+    bool_t data_mode;
+    u08 spi_bits;
+    bool_t half_pending; // RGB444 only: blue nibble of an odd pixel not sent yet
+    u08 half;
+    u08 madctl;
+    volatile bool_t ready;
+    bool_t sleeping;
+    uint64_t sleep_us; // time_us_64() of the last SLPIN
+    uint64_t seq_us;   // time_us_64() when st7789_init or st7789_wake started the sequence
+    u32 ready_us;      // from there to St7789ReadyEvent, measured
+    const struct st7789_step* seq; // command sequence run by the femtox task
+    u08 seq_len;
+    bool_t mirrored; // drawing is also recorded for st7789_mirror_pump, see mirror.h
+    volatile bool_t dlist_busy; // a display list replay owns the pins, see dlist.h
+    // traffic since st7789_init, display list replays included
+    u32 tx_bytes;
+    u32 tx_cmds;
+    u32 tx_pixels;
+    struct st7789_blend blend[ST7789_BLEND_CACHE]; // most recently used first
+    u08 blend_count;
+    u32 blend_misses; // tables built since st7789_init
+};
+
+// Emitted with the panel instance as the pointer argument once it accepts
+// drawing commands after st7789_init.
+extern const void* St7789ReadyEvent;
+
+void display_enable(struct st7789* lcd, bool on);
+// Starts the init sequence as femtox timer tasks and returns immediately,
+// wait for St7789ReadyEvent (or st7789_is_ready) before drawing.
+void st7789_init(struct st7789* lcd, const struct st7789_config* config, u16 width, u16 height);
+bool_t st7789_is_ready(struct st7789* lcd);
+void st7789_set_clk_perif(struct st7789* lcd, u32 clk_perif_khz); // re-derive the SPI baud rate after a clk_peri change
+void st7789_wait_idle(struct st7789* lcd);
+// Pixel data is always passed as RGB565, the instance converts it for RGB444.
+void st7789_write(struct st7789* lcd, const void* data, BaseSize_t len);
+void st7789_write_pixels(struct st7789* lcd, const u16* pixels, u32 count);
+void st7789_write_repeat(struct st7789* lcd, u16 pixel, u32 count);
+// Expands `count` (up to 32) bits, MSB first, to color/bgcolor pixels.
+void st7789_write_mono(struct st7789* lcd, u32 bits, u08 count, u16 color, u16 bgcolor);
+void st7789_put(struct st7789* lcd, u16 pixel);
+void st7789_fill(struct st7789* lcd, u16 pixel);
+void st7789_invert_colors(struct st7789* lcd, bool_t invert);
+void st7789_select_window(struct st7789* lcd, u16 x0, u16 y0, u16 x1, u16 y1);
+void st7789_set_cursor(struct st7789* lcd, u16 x, u16 y);
+void st7789_vertical_scroll(struct st7789* lcd, u16 row);
+// Power saving. Partial mode only scans gate lines start_line..end_line, the rest of
+// the panel shows black. st7789_partial_band scans the gate lines under a screen
+// rectangle (inclusive corners): its rows, or its columns in rotations 2 and 3, so
+// everything in the rectangle's full width or height stays visible. It fails when
+// that would be every line. Sleep keeps the frame memory, st7789_wake skips the
+// init sequence and emits St7789ReadyEvent once drawing is allowed again.
+void st7789_partial_mode(struct st7789* lcd, u16 start_line, u16 end_line);
+bool_t st7789_partial_band(struct st7789* lcd, u16 x0, u16 y0, u16 x1, u16 y1);
+void st7789_normal_mode(struct st7789* lcd);
+void st7789_idle_mode(struct st7789* lcd, bool_t on);
+void st7789_sleep(struct st7789* lcd);
+void st7789_wake(struct st7789* lcd);
+void st7789_rotate_display(struct st7789* lcd, u08 rotation); // @param rotation Type of rotation. Supported values 0, 1, 2, 3
+// Glyphs are drawn `scale` (1 to ST7789_MAX_SCALE) times larger, so small fonts can show big digits.
+// Anti-aliased fonts ignore scale, their pixels come from the blend table of color and bgcolor.
+void st7789_write_string(struct st7789* lcd, u16 x, u16 y, const char *str, FontDef font, u08 scale, u16 color, u16 bgcolor);
+void st7789_draw_line(struct st7789* lcd, u16 x0, u16 y0, u16 x1, u16 y1, u16 color);
+void st7789_draw_filled_rectangle(struct st7789* lcd, u16 x, u16 y, u16 w, u16 h, u16 color);
 
 // Color definitions
 #define	ST_R_POS_RGB   11	// Red last bit position for RGB display
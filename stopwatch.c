@@ -0,0 +1,88 @@
+#include "stopwatch.h"
+
+#include <pico/sync.h>
+
+static critical_section_t stopwatchLock;
+static uint64_t startUs;
+static uint64_t stopUs;
+static uint64_t lapMarkUs;
+static bool_t running = FALSE;
+
+static uint64_t laps[STOPWATCH_LAPS];
+static u08 lapHead = 0;
+static u08 lapCount = 0;
+
+void initStopwatch() {
+    critical_section_init(&stopwatchLock);
+    stopwatchReset();
+}
+
+void stopwatchReset() {
+    critical_section_enter_blocking(&stopwatchLock);
+    running = FALSE;
+    startUs = stopUs = lapMarkUs = 0;
+    lapHead = lapCount = 0;
+    critical_section_exit(&stopwatchLock);
+}
+
+void stopwatchStart(uint64_t timeUs) {
+    critical_section_enter_blocking(&stopwatchLock);
+    startUs = lapMarkUs = timeUs;
+    running = TRUE;
+    critical_section_exit(&stopwatchLock);
+}
+
+static void pushLap(uint64_t timeUs) {
+    laps[lapHead] = timeUs - lapMarkUs;
+    lapHead = (lapHead + 1) % STOPWATCH_LAPS;
+    if(lapCount < STOPWATCH_LAPS) lapCount++;
+    lapMarkUs = timeUs;
+}
+
+void stopwatchStop(uint64_t timeUs) {
+    critical_section_enter_blocking(&stopwatchLock);
+    if(running) {
+        pushLap(timeUs);
+        stopUs = timeUs;
+        running = FALSE;
+    }
+    critical_section_exit(&stopwatchLock);
+}
+
+void stopwatchLap(uint64_t timeUs) {
+    critical_section_enter_blocking(&stopwatchLock);
+    if(running) pushLap(timeUs);
+    critical_section_exit(&stopwatchLock);
+}
+
+bool_t stopwatchIsRunning() {
+    return running;
+}
+
+bool_t stopwatchRunningAt(uint64_t timeUs) {
+    critical_section_enter_blocking(&stopwatchLock);
+    uint64_t end = running ? timeUs : stopUs; // a reset leaves start == stop
+    bool_t inside = timeUs >= startUs && timeUs <= end && (running || startUs != stopUs);
+    critical_section_exit(&stopwatchLock);
+    return inside;
+}
+
+uint64_t stopwatchElapsed(uint64_t nowUs) {
+    critical_section_enter_blocking(&stopwatchLock);
+    uint64_t end = running ? nowUs : stopUs;
+    uint64_t elapsed = end > startUs ? end - startUs : 0;
+    critical_section_exit(&stopwatchLock);
+    return elapsed;
+}
+
+u08 stopwatchLapCount() {
+    return lapCount;
+}
+
+uint64_t stopwatchGetLap(u08 n) {
+    if(n >= lapCount) return 0;
+    critical_section_enter_blocking(&stopwatchLock);
+    uint64_t lap = laps[(lapHead + STOPWATCH_LAPS - 1 - n) % STOPWATCH_LAPS];
+    critical_section_exit(&stopwatchLock);
+    return lap;
+}
@@ -0,0 +1,22 @@
+#ifndef STOPWATCH_H_
+#define STOPWATCH_H_
+
+#include <stdint.h>
+#include "femtox/FemtoxTypes.h"
+
+#define STOPWATCH_LAPS 8 // capacity of the lap ring, the oldest lap is overwritten
+
+// All timestamps are time_us_64() values, so the start/stop accuracy
+// depends only on when the timestamp was taken, not when the task runs.
+void initStopwatch();
+void stopwatchReset();
+void stopwatchStart(uint64_t timeUs);
+void stopwatchStop(uint64_t timeUs);
+void stopwatchLap(uint64_t timeUs);
+bool_t stopwatchIsRunning();
+bool_t stopwatchRunningAt(uint64_t timeUs); // TRUE when timeUs falls into the current or last run
+uint64_t stopwatchElapsed(uint64_t nowUs);
+u08 stopwatchLapCount();
+uint64_t stopwatchGetLap(u08 n); // n = 0 is the most recent lap
+
+#endif /*STOPWATCH_H_*/
@@ -0,0 +1,173 @@
+// Runs the interpolator blit kernels of st7789/blit.c on the host, built as device
+// code against the interp0 emulation in host/include/hardware/interp.h, and
+// compares every output pixel with the plain *_ref loops:
+// - blit_glyph: all 65536 font rows at every width 1..16, three color pairs
+// - blit_glyph4: all 256 coverage pairs at widths 1..40
+// - blit_lut8: all 256 palette indices at both pair alignments, counts 0..300
+// - blit_scale: a sweep of 16.16 steps and start offsets over a 32768 pixel row
+// - st7789_blit_lut8 / st7789_blit_scaled against directly computed windows
+// - blit_benchmark's own mismatch counters
+#define PICO_ON_DEVICE 1
+#include "blit.c"
+
+#include <stdio.h>
+#include <string.h>
+
+unsigned int get_core_num(void) {
+    return 0;
+}
+
+// window blits land in a framebuffer instead of the panel
+#define FB_WIDTH 320
+#define FB_HEIGHT 240
+static u16 fb[FB_WIDTH * FB_HEIGHT];
+static u16 win_x0, win_y0, win_x1;
+static u32 win_pos;
+
+void st7789_select_window(struct st7789* lcd, u16 x0, u16 y0, u16 x1, u16 y1) {
+    win_x0 = x0;
+    win_y0 = y0;
+    win_x1 = x1;
+    win_pos = 0;
+}
+
+void st7789_write_pixels(struct st7789* lcd, const u16* pixels, u32 count) {
+    u32 w = win_x1 - win_x0 + 1;
+    for(; count--; win_pos++) fb[(win_y0 + win_pos / w) * FB_WIDTH + win_x0 + win_pos % w] = *pixels++;
+}
+
+static u32 compared;
+static u32 failures;
+
+static void check(const char* kernel, const u16* got, const u16* want, u32 count, u32 param) {
+    compared += count;
+    for(u32 i = 0; i < count; i++) {
+        if(got[i] == want[i]) continue;
+        if(failures++ < 10) printf("%s (%u): pixel %u is %04X, expected %04X\n", kernel, param, i, got[i], want[i]);
+    }
+}
+
+static u32 seed = 0x2545F491;
+static u32 random32() {
+    seed = seed * 1664525 + 1013904223;
+    return seed;
+}
+
+// all static: the kernels hand these addresses to 32 bit interpolator registers
+static u16 rows[65536];
+static u16 fast[255 * 40 + 16];
+static u16 ref[255 * 40 + 16];
+static u08 coverage[512];
+static u16 levels[16];
+static u08 indices[4096];
+static u16 palette[256];
+static u16 source[32768];
+static u16 image[64 * 48];
+
+static void test_glyph() {
+    const u16 colors[][2] = {{ST_COLOR_WHITE, ST_COLOR_BLACK}, {ST_COLOR_RED, ST_COLOR_NAVY}, {0x1234, 0x1234}};
+    for(u32 i = 0; i < 65536; i++) rows[i] = i;
+    for(u08 c = 0; c < 3; c++) {
+        for(u08 width = 1; width <= 16; width++) {
+            for(u32 first = 0; first < 65536; first += 255) {
+                u08 height = 65536 - first < 255 ? 65536 - first : 255;
+                blit_glyph(fast, rows + first, width, height, colors[c][0], colors[c][1]);
+                blit_glyph_ref(ref, rows + first, width, height, colors[c][0], colors[c][1]);
+                check("blit_glyph", fast, ref, (u32)width * height, width);
+            }
+        }
+    }
+}
+
+static void test_glyph4() {
+    for(u32 i = 0; i < 512; i++) coverage[i] = i;
+    for(u08 i = 0; i < 16; i++) levels[i] = random32() >> 16;
+    for(u08 width = 1; width <= 40; width++) {
+        u08 stride = (width + 1) / 2;
+        for(u32 first = 0; first < 256; first += 128) {
+            u08 height = (128 + stride - 1) / stride;
+            blit_glyph4(fast, coverage + first, width, height, levels);
+            blit_glyph4_ref(ref, coverage + first, width, height, levels);
+            check("blit_glyph4", fast, ref, (u32)width * height, width);
+        }
+    }
+}
+
+static void test_lut8() {
+    for(u32 i = 0; i < 256; i++) palette[i] = random32() >> 16;
+    for(u32 i = 0; i < 4096; i++) indices[i] = i;
+    for(u08 offset = 0; offset < 2; offset++) {
+        for(u32 count = 0; count <= 300; count++) {
+            blit_lut8(fast, indices + offset, count, palette);
+            blit_lut8_ref(ref, indices + offset, count, palette);
+            check("blit_lut8", fast, ref, count, count);
+        }
+    }
+}
+
+static void test_scale() {
+    const u32 count = 240;
+    for(u32 i = 0; i < 32768; i++) source[i] = random32() >> 16;
+    for(u32 step = 1; step <= 0x800000; step = step * 5 / 4 + 1) {
+        const u32 starts[] = {0, 0x8000, 0xFFFF, 0x12345, 0x7FFF0000};
+        for(u08 s = 0; s < sizeof(starts) / sizeof(starts[0]); s++) {
+            u32 u = starts[s];
+            if((((uint64_t)u + (uint64_t)(count - 1) * step) >> 16) >= 32768) continue;
+            blit_scale(fast, count, source, u, step);
+            blit_scale_ref(ref, count, source, u, step);
+            check("blit_scale", fast, ref, count, step);
+        }
+    }
+}
+
+static void test_windows() {
+    struct st7789 lcd;
+    u16 want[FB_WIDTH];
+    for(u32 i = 0; i < 64 * 48; i++) image[i] = random32() >> 16;
+    // a window longer than the line buffer and one that is a single row
+    const u16 sizes[][2] = {{17, 13}, {300, 7}, {240, 1}};
+    for(u08 k = 0; k < 3; k++) {
+        u16 w = sizes[k][0], h = sizes[k][1];
+        st7789_blit_lut8(&lcd, 3, 5, w, h, indices, palette);
+        for(u16 y = 0; y < h; y++) {
+            for(u16 x = 0; x < w; x++) want[x] = palette[indices[(u32)y * w + x]];
+            check("st7789_blit_lut8", fb + (5 + y) * FB_WIDTH + 3, want, w, w);
+        }
+    }
+    // up, down and mixed scaling, destination rows repeat when h > src_h
+    const u16 scales[][4] = {{64, 48, 240, 200}, {64, 48, 20, 11}, {64, 48, 300, 30}, {7, 3, 240, 240}};
+    for(u08 k = 0; k < 4; k++) {
+        u16 src_w = scales[k][0], src_h = scales[k][1], w = scales[k][2], h = scales[k][3];
+        u32 step_x = ((u32)src_w << 16) / w, step_y = ((u32)src_h << 16) / h;
+        st7789_blit_scaled(&lcd, 0, 0, w, h, image, src_w, src_h);
+        for(u16 y = 0; y < h; y++) {
+            for(u16 x = 0; x < w; x++) want[x] = image[(y * step_y >> 16) * src_w + (x * step_x >> 16)];
+            check("st7789_blit_scaled", fb + (u32)y * FB_WIDTH, want, w, w);
+        }
+    }
+}
+
+static void test_benchmark() {
+    struct blit_bench bench;
+    blit_benchmark(&bench);
+    for(u08 k = 0; k < BLIT_KERNEL_COUNT; k++) {
+        if(bench.mismatches[k] == 0) continue;
+        printf("blit_benchmark: kernel %u reports %u mismatches\n", k, bench.mismatches[k]);
+        failures++;
+    }
+}
+
+int main() {
+    if((uintptr_t)rows > 0xFFFFFFFFu || (uintptr_t)glyph_tables > 0xFFFFFFFFu) {
+        printf("test data above 4 GiB, build without PIE\n");
+        return 2;
+    }
+    test_glyph();
+    test_glyph4();
+    test_lut8();
+    test_scale();
+    test_windows();
+    test_benchmark();
+    printf("blit: %u pixels compared, %u differ\n", compared, failures);
+    return failures != 0;
+}
@@ -0,0 +1,92 @@
+// Runs the analog clock face of analogclock.c over two hours of seconds on a host
+// framebuffer. After every incremental update a second face draws the whole dial
+// over it, which has to leave every pixel as it was. Reports the SPI bytes of the
+// full face and of the updates, counted the way the driver counts tx_bytes.
+#include "hardware/spi.h" // st7789.h uses the SPI types without including them
+#include "analogclock.c"
+
+#include <stdio.h>
+#include <string.h>
+
+#define FB_SIZE 240
+#define RUN_SECONDS 7200
+
+static u32 failures;
+#define CHECK(cond) do { \
+    if(!(cond)) { \
+        failures++; \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+    } \
+} while(0)
+
+// the driver calls the face uses, landing in a framebuffer
+static u16 fb[FB_SIZE][FB_SIZE];
+static u16 winX0, winX1, winY1, curX, curY;
+
+static void put(u16 pixel) {
+    CHECK(curY <= winY1);
+    fb[curY][curX] = pixel;
+    if(++curX > winX1) {
+        curX = winX0;
+        curY++;
+    }
+}
+
+void st7789_select_window(struct st7789* lcd, u16 x0, u16 y0, u16 x1, u16 y1) {
+    winX0 = curX = x0;
+    winX1 = x1;
+    curY = y0;
+    winY1 = y1;
+    lcd->tx_bytes += 11; // CASET and RASET with their parameters, RAMWR
+}
+
+void st7789_write_pixels(struct st7789* lcd, const u16* pixels, u32 count) {
+    lcd->tx_bytes += count * 2;
+    while(count--) put(*pixels++);
+}
+
+void st7789_write_repeat(struct st7789* lcd, u16 pixel, u32 count) {
+    lcd->tx_bytes += count * 2;
+    while(count--) put(pixel);
+}
+
+void st7789_draw_filled_rectangle(struct st7789* lcd, u16 x, u16 y, u16 w, u16 h, u16 color) {
+    st7789_select_window(lcd, x, y, x + w - 1, y + h - 1);
+    st7789_write_repeat(lcd, color, (u32)w * h);
+}
+
+static u16 before[FB_SIZE][FB_SIZE];
+
+int main() {
+    static struct st7789 lcd = {.width = FB_SIZE, .height = FB_SIZE};
+    static WidgetLayer_t ui;
+    static ClockFace_t face, reference;
+    ui.lcd = &lcd;
+    ui.theme[THEME_BACKGROUND] = ST_COLOR_BLACK;
+    ui.theme[THEME_FOREGROUND] = ST_COLOR_WHITE;
+    ui.theme[THEME_ACCENT] = ST_COLOR_RED;
+    // where main.c puts it
+    clockFaceInit(&face, &ui, FB_SIZE / 2, 148, 48);
+    clockFaceInit(&reference, &ui, FB_SIZE / 2, 148, 48);
+
+    u32 start = 10 * 3600 + 7 * 60 + 3;
+    clockFaceUpdate(&face, start);
+    u32 full = face.lastBytes;
+    uint64_t total = 0;
+    u32 mismatches = 0;
+    for(u32 t = start + 1; t <= start + RUN_SECONDS; t++) {
+        clockFaceUpdate(&face, t);
+        total += face.lastBytes;
+        memcpy(before, fb, sizeof(fb));
+        clockFaceInvalidate(&reference);
+        clockFaceUpdate(&reference, t);
+        if(memcmp(before, fb, sizeof(fb))) mismatches++;
+    }
+    CHECK(mismatches == 0);
+    CHECK(face.overBudget == 0);
+    CHECK(face.maxBytes <= CLOCK_FACE_BUDGET);
+    printf("face: full %u bytes, %u updates: %u bytes/s average, %u at most, %u differ from a full redraw\n",
+        full, RUN_SECONDS, (u32)(total / RUN_SECONDS), face.maxBytes, mismatches);
+    printf("face: %s\n", failures ? "FAIL" : "PASS");
+    return failures != 0;
+}
@@ -0,0 +1,169 @@
+// Runs the button debounce of gpio.c on sched.c and a fake femtox. The pin keeps
+// edge latches like IO_BANK0: an edge is latched whether or not its interrupt is
+// enabled, enabling or disabling clears it, and the callback sees only enabled
+// ones. Presses and releases the button a few times and counts the events.
+#include <stdio.h>
+
+#include "gpio.h"
+#include "sched.h"
+#include "hardware/gpio.h"
+
+#define PRESSES 3
+#define HOLD_MS 300
+#define IDLE_MS 400
+
+static u32 failures;
+#define CHECK(cond) do { \
+    if(!(cond)) { \
+        failures++; \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+    } \
+} while(0)
+
+// fake femtox, one tick per millisecond
+#define FEMTOX_QUEUE 64
+static struct {
+    TaskMng task;
+    BaseSize_t n;
+    BaseParam_t p;
+} femtoxQueue[FEMTOX_QUEUE];
+static u16 femtoxHead, femtoxCount;
+static CycleFuncPtr timerPoll;
+static u32 tick;
+
+void SetTask(TaskMng task, BaseSize_t n, BaseParam_t p) {
+    CHECK(femtoxCount < FEMTOX_QUEUE);
+    u16 tail = (femtoxHead + femtoxCount++) % FEMTOX_QUEUE;
+    femtoxQueue[tail].task = task;
+    femtoxQueue[tail].n = n;
+    femtoxQueue[tail].p = p;
+}
+
+void SetCycleTask(Time_t period, CycleFuncPtr func, bool_t ready) {
+    timerPoll = func;
+}
+
+u32 getTick(void) {
+    return tick;
+}
+
+uint64_t time_us_64(void) {
+    return (uint64_t)tick * 1000;
+}
+
+static void runFemtox() {
+    while(femtoxCount) {
+        TaskMng task = femtoxQueue[femtoxHead].task;
+        BaseSize_t n = femtoxQueue[femtoxHead].n;
+        BaseParam_t p = femtoxQueue[femtoxHead].p;
+        femtoxHead = (femtoxHead + 1) % FEMTOX_QUEUE;
+        femtoxCount--;
+        task(n, p);
+    }
+}
+
+static void advance(u32 ticks) {
+    while(ticks--) {
+        tick++;
+        timerPoll();
+        runFemtox();
+    }
+}
+
+// the button pin, pulled up, low while pressed
+static bool level = true;
+static uint32_t enabled, latched;
+static gpio_irq_callback_t callback;
+
+static void raiseIrq() {
+    uint32_t events = latched & enabled;
+    if(!events || callback == NULL) return;
+    latched &= ~events; // the SDK acknowledges before calling back
+    callback(BUTTON, events);
+}
+
+void gpio_init(uint gpio) {}
+void gpio_set_dir(uint gpio, bool out) {}
+void gpio_pull_up(uint gpio) {}
+void gpio_put(uint gpio, bool value) {}
+void gpio_set_slew_rate(uint gpio, enum gpio_slew_rate slew) {}
+
+bool gpio_get(uint gpio) {
+    return gpio == BUTTON ? level : true;
+}
+
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool on) {
+    CHECK(gpio == BUTTON);
+    latched &= ~event_mask;
+    if(on) enabled |= event_mask;
+    else enabled &= ~event_mask;
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool on, gpio_irq_callback_t cb) {
+    callback = cb;
+    gpio_set_irq_enabled(gpio, event_mask, on);
+}
+
+static void setButton(bool up) {
+    if(up == level) return;
+    level = up;
+    latched |= up ? GPIO_IRQ_EDGE_RISE : GPIO_IRQ_EDGE_FALL;
+    raiseIrq();
+    runFemtox();
+}
+
+static u32 clicks, pressed, released;
+static uint32_t lastHeldUs;
+
+static void onClick(BaseSize_t n, const ButtonEvent_t* click) {
+    CHECK(n == sizeof(ButtonEvent_t));
+    lastHeldUs = click->heldUs;
+    clicks++;
+}
+
+static void onPressed(BaseSize_t n, BaseParam_t p) {
+    pressed++;
+}
+
+static void onReleased(BaseSize_t n, BaseParam_t p) {
+    released++;
+}
+
+int main() {
+    initSched();
+    initInput();
+    CHECK(schedConnect((TaskMng)onClick, ClickEvent));
+    CHECK(schedConnect(onPressed, PressedEvent));
+    CHECK(schedConnect(onReleased, ReleasedEvent));
+    advance(IDLE_MS);
+
+    for(u32 i = 1; i <= PRESSES; i++) {
+        setButton(false);
+        advance(HOLD_MS);
+        CHECK(pressed == i);
+        CHECK(clicks == i - 1);
+        setButton(true);
+        advance(IDLE_MS);
+        CHECK(clicks == i);
+        CHECK(released == i);
+        // the click is taken at the first check that sees the button up
+        CHECK(lastHeldUs >= HOLD_MS * 1000 && lastHeldUs <= (HOLD_MS + TICK_PER_SECOND / 16) * 1000);
+        CHECK(enabled == (GPIO_IRQ_EDGE_FALL | GPIO_IRQ_EDGE_RISE));
+    }
+
+    // a bounce on release must not lose the next press
+    setButton(false);
+    advance(HOLD_MS);
+    setButton(true);
+    advance(TICK_PER_SECOND / 16 + 1);
+    setButton(false);
+    advance(HOLD_MS);
+    setButton(true);
+    advance(IDLE_MS);
+    CHECK(clicks == PRESSES + 2);
+    CHECK(released == PRESSES + 1);
+
+    printf("gpio: %u clicks, %u pressed, %u released\n", clicks, pressed, released);
+    printf("gpio: %s\n", failures ? "FAIL" : "PASS");
+    return failures != 0;
+}
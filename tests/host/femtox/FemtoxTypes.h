@@ -0,0 +1,23 @@
+// Host stand-in for the femtox types, only what the code under test uses.
+#ifndef HOST_FEMTOX_TYPES_H_
+#define HOST_FEMTOX_TYPES_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+typedef uint8_t u08;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef int8_t s08;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef u08 bool_t;
+typedef u32 BaseSize_t;
+typedef void* BaseParam_t;
+typedef u32 Time_t;
+
+#define TRUE 1
+#define FALSE 0
+
+#endif /*HOST_FEMTOX_TYPES_H_*/
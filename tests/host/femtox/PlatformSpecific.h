@@ -0,0 +1,7 @@
+// Host stand-in for the femtox platform header, nothing the code under test uses.
+#ifndef HOST_FEMTOX_PLATFORMSPECIFIC_H_
+#define HOST_FEMTOX_PLATFORMSPECIFIC_H_
+
+#include "TaskMngr.h"
+
+#endif /*HOST_FEMTOX_PLATFORMSPECIFIC_H_*/
@@ -0,0 +1,19 @@
+// Host stand-in for the femtox task manager interface. The tests provide the
+// functions they need, so a missing one is a link error rather than a silent no-op.
+#ifndef HOST_FEMTOX_TASKMNGR_H_
+#define HOST_FEMTOX_TASKMNGR_H_
+
+#include "FemtoxTypes.h"
+
+#define TICK_PER_SECOND 1000
+
+typedef void (*TaskMng)(BaseSize_t n, BaseParam_t p);
+typedef void (*CycleFuncPtr)(void);
+
+void SetTask(TaskMng task, BaseSize_t n, BaseParam_t p);
+void SetTimerTask(TaskMng task, BaseSize_t n, BaseParam_t p, Time_t delay);
+void SetCycleTask(Time_t period, CycleFuncPtr func, bool_t ready);
+void emitSignal(const void* signal, BaseSize_t n, BaseParam_t p);
+u32 getTick(void);
+
+#endif /*HOST_FEMTOX_TASKMNGR_H_*/
@@ -0,0 +1,38 @@
+// Host stand-in for hardware/gpio.h. Declarations only, the test that links
+// gpio.c models the pin and its edge latches itself.
+#ifndef HOST_HARDWARE_GPIO_H_
+#define HOST_HARDWARE_GPIO_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
+
+#define GPIO_IN false
+#define GPIO_OUT true
+
+enum gpio_irq_level {
+    GPIO_IRQ_LEVEL_LOW = 0x1u,
+    GPIO_IRQ_LEVEL_HIGH = 0x2u,
+    GPIO_IRQ_EDGE_FALL = 0x4u,
+    GPIO_IRQ_EDGE_RISE = 0x8u,
+};
+
+enum gpio_slew_rate {
+    GPIO_SLEW_RATE_SLOW = 0,
+    GPIO_SLEW_RATE_FAST = 1
+};
+
+typedef void (*gpio_irq_callback_t)(uint gpio, uint32_t event_mask);
+
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_pull_up(uint gpio);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
+void gpio_set_slew_rate(uint gpio, enum gpio_slew_rate slew);
+// like the SDK, enabling or disabling clears the latched edges first
+void gpio_set_irq_enabled(uint gpio, uint32_t event_mask, bool enabled);
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t event_mask, bool enabled, gpio_irq_callback_t callback);
+
+#endif /*HOST_HARDWARE_GPIO_H_*/
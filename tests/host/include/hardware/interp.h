@@ -0,0 +1,143 @@
+// Host emulation of one RP2040 interpolator, enough to run the blit kernels in
+// st7789/blit.c unchanged. C++ only: register reads compute the lane results the
+// way the hardware does, which plain struct members cannot.
+//
+// Lane i: the input is accum[i], or accum[1 - i] with CROSS_INPUT, shifted right
+// by SHIFT and masked to MASK_LSB..MASK_MSB. PEEK[i] is that plus base[i], or the
+// unshifted input plus base[i] with ADD_RAW. PEEK[2] is base[2] plus both masked
+// values. POP reads the same and writes each lane result back to its accumulator.
+// Addresses are kept in 32 bit registers as on the device, so the data a kernel
+// points the lanes at has to live below 4 GiB (build without PIE).
+#ifndef HOST_HARDWARE_INTERP_H_
+#define HOST_HARDWARE_INTERP_H_
+
+#ifndef __cplusplus
+#error "the interpolator emulation needs C++, build the test as C++"
+#endif
+
+#include <stdint.h>
+
+#define SIO_INTERP0_CTRL_LANE0_SHIFT_LSB 0
+#define SIO_INTERP0_CTRL_LANE0_MASK_LSB_LSB 5
+#define SIO_INTERP0_CTRL_LANE0_MASK_MSB_LSB 10
+#define SIO_INTERP0_CTRL_LANE0_SIGNED_BITS (1u << 15)
+#define SIO_INTERP0_CTRL_LANE0_CROSS_INPUT_BITS (1u << 16)
+#define SIO_INTERP0_CTRL_LANE0_CROSS_RESULT_BITS (1u << 17)
+#define SIO_INTERP0_CTRL_LANE0_ADD_RAW_BITS (1u << 18)
+
+struct interp_hw_t;
+
+struct interp_state {
+    uint32_t accum[2];
+    uint32_t base[3];
+    uint32_t ctrl[2];
+
+    uint32_t masked(int lane) const {
+        uint32_t ctrl_lane = ctrl[lane];
+        uint32_t in = accum[(ctrl_lane & SIO_INTERP0_CTRL_LANE0_CROSS_INPUT_BITS) ? 1 - lane : lane];
+        uint32_t shift = (ctrl_lane >> SIO_INTERP0_CTRL_LANE0_SHIFT_LSB) & 31;
+        uint32_t lsb = (ctrl_lane >> SIO_INTERP0_CTRL_LANE0_MASK_LSB_LSB) & 31;
+        uint32_t msb = (ctrl_lane >> SIO_INTERP0_CTRL_LANE0_MASK_MSB_LSB) & 31;
+        uint32_t mask = (msb == 31 ? 0xFFFFFFFFu : (2u << msb) - 1) & ~((1u << lsb) - 1);
+        uint32_t value = (in >> shift) & mask;
+        if((ctrl_lane & SIO_INTERP0_CTRL_LANE0_SIGNED_BITS) && msb < 31 && (value & (1u << msb))) {
+            value |= ~((2u << msb) - 1);
+        }
+        return value;
+    }
+
+    uint32_t result(int lane) const {
+        if(lane == 2) return base[2] + masked(0) + masked(1);
+        uint32_t ctrl_lane = ctrl[lane];
+        if(ctrl_lane & SIO_INTERP0_CTRL_LANE0_ADD_RAW_BITS) {
+            return accum[(ctrl_lane & SIO_INTERP0_CTRL_LANE0_CROSS_INPUT_BITS) ? 1 - lane : lane] + base[lane];
+        }
+        return masked(lane) + base[lane];
+    }
+
+    uint32_t read(int lane, bool pop) {
+        uint32_t value = result(lane);
+        if(pop) {
+            uint32_t r0 = result(0), r1 = result(1);
+            accum[0] = (ctrl[0] & SIO_INTERP0_CTRL_LANE0_CROSS_RESULT_BITS) ? r1 : r0;
+            accum[1] = (ctrl[1] & SIO_INTERP0_CTRL_LANE0_CROSS_RESULT_BITS) ? r0 : r1;
+        }
+        return value;
+    }
+};
+
+// accum and base registers, plain storage
+struct interp_reg {
+    uint32_t* value;
+    interp_reg& operator=(uint32_t v) {
+        *value = v;
+        return *this;
+    }
+    operator uint32_t() const {
+        return *value;
+    }
+};
+
+// peek and pop registers, computed on every read
+struct interp_result_reg {
+    interp_state* state;
+    int lane;
+    bool pop;
+    operator uint32_t() const {
+        return state->read(lane, pop);
+    }
+    template<class T> operator T*() const {
+        return (T*)(uintptr_t)state->read(lane, pop);
+    }
+};
+
+struct interp_hw_t {
+    interp_state state;
+    interp_reg accum[2];
+    interp_reg base[3];
+    interp_result_reg peek[3];
+    interp_result_reg pop[3];
+
+    interp_hw_t() :
+        state(),
+        accum{{&state.accum[0]}, {&state.accum[1]}},
+        base{{&state.base[0]}, {&state.base[1]}, {&state.base[2]}},
+        peek{{&state, 0, false}, {&state, 1, false}, {&state, 2, false}},
+        pop{{&state, 0, true}, {&state, 1, true}, {&state, 2, true}} {}
+};
+
+static interp_hw_t host_interp0;
+#define interp0 (&host_interp0)
+
+typedef struct {
+    uint32_t ctrl;
+} interp_config;
+
+static inline interp_config interp_default_config() {
+    interp_config c = {31u << SIO_INTERP0_CTRL_LANE0_MASK_MSB_LSB};
+    return c;
+}
+
+static inline void interp_config_set_shift(interp_config* c, unsigned shift) {
+    c->ctrl = (c->ctrl & ~(31u << SIO_INTERP0_CTRL_LANE0_SHIFT_LSB)) | shift << SIO_INTERP0_CTRL_LANE0_SHIFT_LSB;
+}
+
+static inline void interp_config_set_mask(interp_config* c, unsigned lsb, unsigned msb) {
+    c->ctrl = (c->ctrl & ~(0x3FFu << SIO_INTERP0_CTRL_LANE0_MASK_LSB_LSB))
+        | lsb << SIO_INTERP0_CTRL_LANE0_MASK_LSB_LSB
+        | msb << SIO_INTERP0_CTRL_LANE0_MASK_MSB_LSB;
+}
+
+static inline void interp_config_set_cross_input(interp_config* c, bool cross) {
+    c->ctrl = (c->ctrl & ~SIO_INTERP0_CTRL_LANE0_CROSS_INPUT_BITS) | (cross ? SIO_INTERP0_CTRL_LANE0_CROSS_INPUT_BITS : 0);
+}
+
+static inline void interp_config_set_add_raw(interp_config* c, bool add_raw) {
+    c->ctrl = (c->ctrl & ~SIO_INTERP0_CTRL_LANE0_ADD_RAW_BITS) | (add_raw ? SIO_INTERP0_CTRL_LANE0_ADD_RAW_BITS : 0);
+}
+
+static inline void interp_set_config(interp_hw_t* interp, unsigned lane, interp_config* c) {
+    interp->state.ctrl[lane] = c->ctrl;
+}
+
+#endif /*HOST_HARDWARE_INTERP_H_*/
@@ -0,0 +1,8 @@
+// Host stand-in for hardware/pio.h, only the handle type the display list API uses.
+#ifndef HOST_HARDWARE_PIO_H_
+#define HOST_HARDWARE_PIO_H_
+
+typedef struct pio_hw pio_hw_t;
+typedef pio_hw_t* PIO;
+
+#endif /*HOST_HARDWARE_PIO_H_*/
@@ -0,0 +1,7 @@
+// Host stand-in for hardware/spi.h, the panel config only carries the pointer.
+#ifndef HOST_HARDWARE_SPI_H_
+#define HOST_HARDWARE_SPI_H_
+
+typedef struct spi_inst spi_inst_t;
+
+#endif /*HOST_HARDWARE_SPI_H_*/
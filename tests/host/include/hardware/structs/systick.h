@@ -0,0 +1,18 @@
+// Host stand-in for the SysTick registers, the counter never moves so host
+// "cycle" counts are zero and only the comparisons mean anything.
+#ifndef HOST_HARDWARE_STRUCTS_SYSTICK_H_
+#define HOST_HARDWARE_STRUCTS_SYSTICK_H_
+
+#include <stdint.h>
+
+typedef struct {
+    volatile uint32_t csr;
+    volatile uint32_t rvr;
+    volatile uint32_t cvr;
+    volatile uint32_t calib;
+} systick_hw_t;
+
+static systick_hw_t host_systick;
+#define systick_hw (&host_systick)
+
+#endif /*HOST_HARDWARE_STRUCTS_SYSTICK_H_*/
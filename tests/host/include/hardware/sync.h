@@ -0,0 +1,15 @@
+// Host stand-in for hardware/sync.h, a single thread has nothing to mask.
+#ifndef HOST_HARDWARE_SYNC_H_
+#define HOST_HARDWARE_SYNC_H_
+
+#include <stdint.h>
+
+static inline uint32_t save_and_disable_interrupts(void) {
+    return 0;
+}
+
+static inline void restore_interrupts(uint32_t status) {
+    (void)status;
+}
+
+#endif /*HOST_HARDWARE_SYNC_H_*/
@@ -0,0 +1,9 @@
+// Host stand-in for hardware/timer.h, the test provides the clock.
+#ifndef HOST_HARDWARE_TIMER_H_
+#define HOST_HARDWARE_TIMER_H_
+
+#include <stdint.h>
+
+uint64_t time_us_64(void);
+
+#endif /*HOST_HARDWARE_TIMER_H_*/
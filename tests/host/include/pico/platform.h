@@ -0,0 +1,20 @@
+// Host stand-in for pico/platform.h.
+#ifndef HOST_PICO_PLATFORM_H_
+#define HOST_PICO_PLATFORM_H_
+
+#ifndef PICO_ON_DEVICE
+#define PICO_ON_DEVICE 0
+#endif
+
+#define __not_in_flash(group)
+#define __not_in_flash_func(name) name
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+unsigned int get_core_num(void);
+#ifdef __cplusplus
+}
+#endif
+
+#endif /*HOST_PICO_PLATFORM_H_*/
@@ -0,0 +1,55 @@
+// Host stand-in for pico/sync.h. The tests are single threaded, a lock taken
+// twice means a re-entrant call under the lock and aborts.
+#ifndef HOST_PICO_SYNC_H_
+#define HOST_PICO_SYNC_H_
+
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "pico/platform.h"
+
+typedef volatile uint32_t spin_lock_t;
+
+static spin_lock_t host_spin_lock;
+
+static inline int spin_lock_claim_unused(bool required) {
+    (void)required;
+    return 0;
+}
+
+static inline spin_lock_t* spin_lock_init(unsigned int lock_num) {
+    (void)lock_num;
+    host_spin_lock = 0;
+    return &host_spin_lock;
+}
+
+static inline uint32_t spin_lock_blocking(spin_lock_t* lock) {
+    assert(*lock == 0);
+    *lock = 1;
+    return 0;
+}
+
+static inline void spin_unlock(spin_lock_t* lock, uint32_t saved_irq) {
+    (void)saved_irq;
+    *lock = 0;
+}
+
+typedef struct {
+    volatile bool owned;
+} mutex_t;
+
+static inline void mutex_init(mutex_t* mtx) {
+    mtx->owned = false;
+}
+
+static inline void mutex_enter_blocking(mutex_t* mtx) {
+    assert(!mtx->owned);
+    mtx->owned = true;
+}
+
+static inline void mutex_exit(mutex_t* mtx) {
+    mtx->owned = false;
+}
+
+#endif /*HOST_PICO_SYNC_H_*/
@@ -0,0 +1,340 @@
+// Stress test of the pooled scheduler in sched.c on a fake femtox: a FIFO for
+// SetTask, the timer poll called once per simulated tick. Every count below is
+// exact, the run ends with one PASS or FAIL line.
+#include <stdio.h>
+
+#include "sched.h"
+
+#define STRESS_ROUNDS 100000
+#define STRESS_WINDOW 24 // live timer handles, below SCHED_TIMERS
+#define MAX_DELAY 16
+
+static u32 failures;
+#define CHECK(cond) do { \
+    if(!(cond)) { \
+        failures++; \
+        printf("%s:%d: %s\n", __FILE__, __LINE__, #cond); \
+    } \
+} while(0)
+
+// fake femtox
+#define FEMTOX_QUEUE 64
+static struct {
+    TaskMng task;
+    BaseSize_t n;
+    BaseParam_t p;
+} femtoxQueue[FEMTOX_QUEUE];
+static u16 femtoxHead, femtoxCount;
+static CycleFuncPtr timerPoll;
+static u32 tick;
+
+void SetTask(TaskMng task, BaseSize_t n, BaseParam_t p) {
+    CHECK(femtoxCount < FEMTOX_QUEUE);
+    u16 tail = (femtoxHead + femtoxCount++) % FEMTOX_QUEUE;
+    femtoxQueue[tail].task = task;
+    femtoxQueue[tail].n = n;
+    femtoxQueue[tail].p = p;
+}
+
+void SetCycleTask(Time_t period, CycleFuncPtr func, bool_t ready) {
+    CHECK(period == 1);
+    timerPoll = func;
+}
+
+u32 getTick(void) {
+    return tick;
+}
+
+static void runFemtox() {
+    while(femtoxCount) {
+        TaskMng task = femtoxQueue[femtoxHead].task;
+        BaseSize_t n = femtoxQueue[femtoxHead].n;
+        BaseParam_t p = femtoxQueue[femtoxHead].p;
+        femtoxHead = (femtoxHead + 1) % FEMTOX_QUEUE;
+        femtoxCount--;
+        task(n, p);
+    }
+}
+
+static void advance(u32 ticks) {
+    while(ticks--) {
+        tick++;
+        timerPoll();
+        runFemtox();
+    }
+}
+
+static u16 poolUsed(SchedPool_t pool) {
+    SchedPoolStats_t stats;
+    schedPoolStats(pool, &stats);
+    return stats.used;
+}
+
+static u32 fired, ran;
+static u32 overflowEvents[SCHED_POOL_COUNT];
+
+static void onTimer(BaseSize_t n, BaseParam_t p) {
+    fired++;
+}
+
+static void onTask(BaseSize_t n, BaseParam_t p) {
+    ran++;
+}
+
+static void onCycle() {
+    ran++;
+}
+
+static void onOverflow(BaseSize_t pool, BaseParam_t p) {
+    overflowEvents[pool]++;
+}
+
+// Random schedule, restart and cancel on a window of timers with posted tasks in
+// between. Every timer has to fire or be cancelled exactly once, every accepted
+// task has to run, and every pool entry has to come back.
+static void randomRounds() {
+    static SchedTimer_t handles[STRESS_WINDOW];
+    u32 seed = 1, created = 0, cancelled = 0, posted = 0;
+    for(u32 round = 0; round < STRESS_ROUNDS; round++) {
+        seed = seed * 1664525 + 1013904223;
+        SchedTimer_t* timer = &handles[(seed >> 24) % STRESS_WINDOW];
+        if(*timer == SCHED_NONE) {
+            *timer = schedTimer(onTimer, round, NULL, 1 + ((seed >> 8) & (MAX_DELAY - 1)));
+            CHECK(*timer != SCHED_NONE);
+            created++;
+        } else if(seed & 0x10000) {
+            cancelled += schedCancel(timer); // FALSE for a timer that already fired
+        } else {
+            SchedTimer_t before = *timer;
+            CHECK(schedRestart(timer, onTimer, round, NULL, 1 + ((seed >> 12) & 7)));
+            created += *timer != before; // it had fired, restart created a new one
+        }
+        if((round & 3) == 0) posted += schedTask(onTask, round, NULL);
+        if((round & 7) == 0) advance(1);
+    }
+    advance(MAX_DELAY + 1);
+    for(u08 i = 0; i < STRESS_WINDOW; i++) CHECK(!schedCancel(&handles[i]));
+
+    CHECK(posted == STRESS_ROUNDS / 4);
+    CHECK(ran == posted);
+    CHECK(fired + cancelled == created);
+    for(u08 pool = 0; pool < SCHED_POOL_COUNT; pool++) {
+        SchedPoolStats_t stats;
+        schedPoolStats(pool, &stats);
+        CHECK(stats.overflows == 0);
+        CHECK(stats.used == (pool == SCHED_POOL_SLOT)); // onOverflow stays connected
+    }
+    printf("sched stress: %u rounds, %u timers created, %u fired, %u cancelled, %u tasks\n",
+        STRESS_ROUNDS, created, fired, cancelled, posted);
+}
+
+// Runs each pool dry: exactly its capacity is handed out, the next request is
+// refused and counted, SchedOverflowEvent reports it once, and freeing returns
+// every entry.
+static void exhaustPools() {
+    static SchedTimer_t handles[SCHED_TIMERS + SCHED_CYCLES];
+    static u08 signals[SCHED_SLOTS];
+    static u08 key;
+    SchedPoolStats_t stats;
+    u16 n;
+
+    for(n = 0; n < SCHED_TIMERS; n++) CHECK((handles[n] = schedTimer(onTimer, n, NULL, 5)) != SCHED_NONE);
+    CHECK(schedTimer(onTimer, 0, NULL, 5) == SCHED_NONE);
+    for(n = 0; n < SCHED_CYCLES; n++) {
+        CHECK((handles[SCHED_TIMERS + n] = schedCycle(10, onCycle)) != SCHED_NONE);
+    }
+    CHECK(schedCycle(10, onCycle) == SCHED_NONE);
+    for(n = 0; n < SCHED_TIMERS + SCHED_CYCLES; n++) CHECK(schedCancel(&handles[n]));
+
+    ran = 0;
+    for(n = 0; n < SCHED_TASKS; n++) CHECK(schedTask(onTask, n, NULL));
+    CHECK(!schedTask(onTask, 0, NULL));
+    runFemtox();
+    CHECK(ran == SCHED_TASKS);
+
+    for(n = 1; n < SCHED_SLOTS; n++) CHECK(schedConnect(onTask, &signals[n])); // slot 0 is onOverflow
+    CHECK(!schedConnect(onTask, &signals[0]));
+    CHECK(schedConnect(onTask, &signals[1])); // already connected, needs no entry
+    for(n = 1; n < SCHED_SLOTS; n++) schedDisconnect(onTask, &signals[n]);
+
+    ran = 0;
+    for(n = 0; n < SCHED_CALLBACKS; n++) CHECK(schedCallBack(onTask, n, NULL, &key));
+    CHECK(!schedCallBack(onTask, 0, NULL, &key));
+    schedExecCallBack(&key);
+    runFemtox();
+    CHECK(ran == SCHED_CALLBACKS);
+
+    const u16 capacity[SCHED_POOL_COUNT] = {SCHED_TASKS, SCHED_TIMERS, SCHED_CYCLES, SCHED_SLOTS, SCHED_CALLBACKS};
+    for(u08 pool = 0; pool < SCHED_POOL_COUNT; pool++) {
+        schedPoolStats(pool, &stats);
+        CHECK(stats.capacity == capacity[pool]);
+        CHECK(stats.highWater == capacity[pool]);
+        CHECK(stats.overflows == 1);
+        CHECK(overflowEvents[pool] == 1);
+        CHECK(stats.used == (pool == SCHED_POOL_SLOT));
+    }
+}
+
+// A handle kept after its timer was cancelled must not touch the entry's next owner.
+static void staleHandles() {
+    SchedTimer_t first = schedTimer(onTimer, 0, NULL, 5);
+    SchedTimer_t stale = first;
+    CHECK(schedCancel(&first));
+    CHECK(first == SCHED_NONE);
+    SchedTimer_t second = schedTimer(onTimer, 0, NULL, 5); // the free list hands out the same entry
+    CHECK(second != stale);
+    CHECK(!schedCancel(&stale));
+    CHECK(poolUsed(SCHED_POOL_TIMER) == 1);
+    CHECK(schedCancel(&second));
+    CHECK(poolUsed(SCHED_POOL_TIMER) == 0);
+}
+
+// Instances a cycle released before it was cancelled are dropped with it, other
+// queued work stays.
+static void cancelQueuedCycle() {
+    ran = 0;
+    SchedTimer_t cycle = schedCycle(2, onCycle);
+    SchedTimer_t other = schedCycle(2, onCycle);
+    tick += 2;
+    timerPoll(); // releases both, femtox has not run the dispatcher yet
+    CHECK(schedTask(onTask, 0, NULL));
+    CHECK(poolUsed(SCHED_POOL_TASK) == 3);
+    CHECK(schedCancel(&cycle));
+    CHECK(poolUsed(SCHED_POOL_TASK) == 2);
+    runFemtox();
+    CHECK(ran == 2);
+    CHECK(schedCancel(&other));
+    CHECK(poolUsed(SCHED_POOL_TASK) == 0);
+    CHECK(poolUsed(SCHED_POOL_CYCLE) == 0);
+}
+
+static u32 order[16];
+static u08 orderCount;
+
+static void onOrder(BaseSize_t n, BaseParam_t p) {
+    if(orderCount < 16) order[orderCount++] = n;
+}
+
+static void onPreempt(BaseSize_t n, BaseParam_t p) {
+    onOrder(n, p);
+    schedTaskPrio(onOrder, n + 1, NULL, SCHED_PRIO_INPUT);
+}
+
+static bool_t orderIs(const u32* want, u08 count) {
+    if(orderCount != count) return FALSE;
+    for(u08 i = 0; i < count; i++) if(order[i] != want[i]) return FALSE;
+    return TRUE;
+}
+
+// The highest non-empty level runs first whatever the deadlines, and a task posted
+// at a higher level by a running one goes ahead of the rest of the lower level.
+static void priorityLevels() {
+    orderCount = 0;
+    CHECK(schedTaskPrio(onOrder, 0, NULL, SCHED_PRIO_BACKGROUND));
+    CHECK(schedTaskPrio(onOrder, 1, NULL, SCHED_PRIO_NORMAL));
+    CHECK(schedTaskPrio(onOrder, 2, NULL, SCHED_PRIO_TIMING));
+    CHECK(schedTaskPrio(onOrder, 3, NULL, SCHED_PRIO_INPUT));
+    runFemtox();
+    const u32 byLevel[] = {3, 2, 1, 0};
+    CHECK(orderIs(byLevel, 4));
+
+    orderCount = 0;
+    CHECK(schedTimerDeadline(onOrder, 0, NULL, 1, 1, SCHED_PRIO(SCHED_PRIO_BACKGROUND)) != SCHED_NONE);
+    CHECK(schedTask(onOrder, 1, NULL)); // normal, due SCHED_BACKGROUND_SLACK later
+    advance(1);
+    const u32 levelBeforeDeadline[] = {1, 0};
+    CHECK(orderIs(levelBeforeDeadline, 2));
+
+    orderCount = 0;
+    CHECK(schedTask(onPreempt, 10, NULL));
+    CHECK(schedTask(onOrder, 20, NULL));
+    runFemtox();
+    const u32 nextDispatch[] = {10, 11, 20};
+    CHECK(orderIs(nextDispatch, 3));
+}
+
+// Inside a level the earliest deadline runs first, tasks without one come after.
+static void edfOrder() {
+    orderCount = 0;
+    CHECK(schedTask(onOrder, 99, NULL));
+    const u32 deadlines[] = {30, 10, 20};
+    for(u08 i = 0; i < 3; i++) {
+        CHECK(schedTimerDeadline(onOrder, deadlines[i], NULL, 1, deadlines[i], SCHED_PRIO(SCHED_PRIO_NORMAL)) != SCHED_NONE);
+    }
+    advance(1);
+    const u32 byDeadline[] = {10, 20, 30, 99};
+    CHECK(orderIs(byDeadline, 4));
+}
+
+static u32 missLate, misses;
+static BaseParam_t missTask;
+
+static void onMiss(BaseSize_t late, BaseParam_t task) {
+    missLate = late;
+    missTask = task;
+    misses++;
+}
+
+static void onOverrun(BaseSize_t ticks, BaseParam_t p) {
+    tick += ticks; // the handler takes that long
+}
+
+// Lateness is counted at completion against release plus deadline.
+static void deadlineMisses() {
+    SchedDeadlineStats_t stats;
+    CHECK(!schedDeadlineStats(onOverrun, &stats));
+    CHECK(schedConnect(onMiss, SchedDeadlineMissEvent));
+    CHECK(schedCriticalOk()); // clears whatever earlier cases left
+
+    CHECK(schedTimerDeadline(onOverrun, 2, NULL, 1, 5, SCHED_PRIO(SCHED_PRIO_NORMAL)) != SCHED_NONE);
+    advance(1);
+    CHECK(misses == 0);
+    CHECK(schedTimerDeadline(onOverrun, 8, NULL, 1, 5, SCHED_PRIO(SCHED_PRIO_NORMAL)) != SCHED_NONE);
+    advance(1);
+    CHECK(schedTimerDeadline(onOverrun, 6, NULL, 1, 5, SCHED_PRIO(SCHED_PRIO_NORMAL)) != SCHED_NONE);
+    advance(1);
+    CHECK(misses == 2);
+    CHECK(missLate == 1);
+    CHECK(missTask == (BaseParam_t)onOverrun);
+    CHECK(schedDeadlineStats(onOverrun, &stats));
+    CHECK(stats.task == onOverrun);
+    CHECK(stats.runs == 3);
+    CHECK(stats.misses == 2);
+    CHECK(stats.worstLateness == 3);
+    CHECK(schedCriticalOk()); // none of them was critical
+
+    // a critical miss fails the next check only
+    CHECK(schedTimerDeadline(onOverrun, 8, NULL, 1, 5, SCHED_CRITICAL) != SCHED_NONE);
+    advance(1);
+    CHECK(misses == 3);
+    CHECK(!schedCriticalOk());
+    CHECK(schedCriticalOk());
+
+    // overdue before it even ran: still in the timer list, then queued
+    CHECK(schedTimerDeadline(onOverrun, 0, NULL, 2, 3, SCHED_CRITICAL) != SCHED_NONE);
+    CHECK(schedCriticalOk());
+    tick += 6;
+    CHECK(!schedCriticalOk());
+    timerPoll(); // released, the dispatcher has not run yet
+    CHECK(!schedCriticalOk());
+    runFemtox();
+    CHECK(misses == 4);
+    CHECK(!schedCriticalOk()); // its miss
+    CHECK(schedCriticalOk());
+    schedDisconnect(onMiss, SchedDeadlineMissEvent);
+}
+
+int main() {
+    initSched();
+    CHECK(timerPoll != NULL);
+    CHECK(schedConnect(onOverflow, SchedOverflowEvent));
+    randomRounds();
+    staleHandles();
+    cancelQueuedCycle();
+    priorityLevels();
+    edfOrder();
+    deadlineMisses();
+    exhaustPools();
+    printf("sched: %s\n", failures ? "FAIL" : "PASS");
+    return failures != 0;
+}
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""Render a TrueType font into a 4bpp anti-aliased FontDef table for st7789/.
+
+Usage: fontgen.py font.ttf width height name > st7789/font_aa.c
+
+Every printable ASCII glyph (32..126) is scaled to fit a width x height cell,
+rasterized with 16x16 samples per pixel (nonzero winding) and stored as 4 bit
+coverage, two pixels per byte with the left one in the high nibble and every
+row padded to whole bytes. No third party modules are needed.
+"""
+import os
+import struct
+import sys
+
+FIRST, LAST = 32, 126
+SUB = 16  # samples per pixel along each axis
+
+
+class TrueType:
+    def __init__(self, path):
+        with open(path, "rb") as f:
+            self.data = f.read()
+        count = struct.unpack_from(">H", self.data, 4)[0]
+        self.tables = {}
+        for i in range(count):
+            tag, _, offset, length = struct.unpack_from(">4sIII", self.data, 12 + 16 * i)
+            self.tables[tag.decode("latin-1")] = (offset, length)
+        head = self.tables["head"][0]
+        self.long_loca = struct.unpack_from(">h", self.data, head + 50)[0] == 1
+        self.metrics = struct.unpack_from(">H", self.data, self.tables["hhea"][0] + 34)[0]
+        self.cmap = self.load_cmap()
+
+    def load_cmap(self):
+        base = self.tables["cmap"][0]
+        count = struct.unpack_from(">H", self.data, base + 2)[0]
+        for i in range(count):
+            platform, encoding, offset = struct.unpack_from(">HHI", self.data, base + 4 + 8 * i)
+            sub = base + offset
+            if (platform, encoding) in ((3, 1), (0, 3)) and struct.unpack_from(">H", self.data, sub)[0] == 4:
+                return self.load_format4(sub)
+        raise ValueError("no unicode BMP cmap")
+
+    def load_format4(self, sub):
+        segs = struct.unpack_from(">H", self.data, sub + 6)[0] // 2
+        ends = struct.unpack_from(">%dH" % segs, self.data, sub + 14)
+        starts = struct.unpack_from(">%dH" % segs, self.data, sub + 16 + 2 * segs)
+        deltas = struct.unpack_from(">%dh" % segs, self.data, sub + 16 + 4 * segs)
+        range_at = sub + 16 + 6 * segs
+        ranges = struct.unpack_from(">%dH" % segs, self.data, range_at)
+        mapping = {}
+        for s in range(segs):
+            for code in range(starts[s], min(ends[s], LAST) + 1):
+                if ranges[s] == 0:
+                    glyph = (code + deltas[s]) & 0xFFFF
+                else:
+                    at = range_at + 2 * s + ranges[s] + 2 * (code - starts[s])
+                    glyph = struct.unpack_from(">H", self.data, at)[0]
+                    if glyph:
+                        glyph = (glyph + deltas[s]) & 0xFFFF
+                mapping[code] = glyph
+        return mapping
+
+    def advance(self, glyph):
+        hmtx = self.tables["hmtx"][0]
+        return struct.unpack_from(">H", self.data, hmtx + 4 * min(glyph, self.metrics - 1))[0]
+
+    def glyph_range(self, glyph):
+        loca = self.tables["loca"][0]
+        if self.long_loca:
+            start, end = struct.unpack_from(">II", self.data, loca + 4 * glyph)
+        else:
+            start, end = (2 * v for v in struct.unpack_from(">HH", self.data, loca + 2 * glyph))
+        return self.tables["glyf"][0] + start, end - start
+
+    def contours(self, glyph):
+        """Closed outlines as lists of (x, y, on_curve) in font units."""
+        at, length = self.glyph_range(glyph)
+        if length == 0:
+            return []
+        ncont = struct.unpack_from(">h", self.data, at)[0]
+        if ncont < 0:
+            return self.composite(at + 10)
+        ends = struct.unpack_from(">%dH" % ncont, self.data, at + 10)
+        npts = ends[-1] + 1 if ncont else 0
+        pos = at + 10 + 2 * ncont
+        pos += 2 + struct.unpack_from(">H", self.data, pos)[0]  # instructions
+        flags = []
+        while len(flags) < npts:
+            flag = self.data[pos]
+            pos += 1
+            repeat = 1
+            if flag & 8:
+                repeat += self.data[pos]
+                pos += 1
+            flags.extend([flag] * repeat)
+        coords = []
+        for short, same in ((2, 16), (4, 32)):
+            value, axis = 0, []
+            for flag in flags:
+                if flag & short:
+                    delta = self.data[pos]
+                    pos += 1
+                    value += delta if flag & same else -delta
+                elif not flag & same:
+                    value += struct.unpack_from(">h", self.data, pos)[0]
+                    pos += 2
+                axis.append(value)
+            coords.append(axis)
+        outlines, start = [], 0
+        for end in ends:
+            outlines.append([(coords[0][i], coords[1][i], flags[i] & 1) for i in range(start, end + 1)])
+            start = end + 1
+        return outlines
+
+    def composite(self, pos):
+        outlines = []
+        while True:
+            flags, glyph = struct.unpack_from(">HH", self.data, pos)
+            pos += 4
+            if flags & 1:
+                dx, dy = struct.unpack_from(">hh", self.data, pos)
+                pos += 4
+            else:
+                dx, dy = struct.unpack_from(">bb", self.data, pos)
+                pos += 2
+            a, b, c, d = 1.0, 0.0, 0.0, 1.0
+            if flags & 8:
+                a = d = struct.unpack_from(">h", self.data, pos)[0] / 16384.0
+                pos += 2
+            elif flags & 0x40:
+                a, d = (v / 16384.0 for v in struct.unpack_from(">hh", self.data, pos))
+                pos += 4
+            elif flags & 0x80:
+                a, b, c, d = (v / 16384.0 for v in struct.unpack_from(">hhhh", self.data, pos))
+                pos += 8
+            for outline in self.contours(glyph):
+                outlines.append([(a * x + c * y + dx, b * x + d * y + dy, on) for x, y, on in outline])
+            if not flags & 0x20:
+                return outlines
+
+
+def flatten(outline, steps=8):
+    """Line segments of a quadratic outline, implied on-curve points included."""
+    points = []
+    n = len(outline)
+    for i in range(n):
+        x, y, on = outline[i]
+        nx, ny, non = outline[(i + 1) % n]
+        points.append((x, y, on))
+        if not on and not non:
+            points.append(((x + nx) / 2.0, (y + ny) / 2.0, 1))
+    start = next(i for i, p in enumerate(points) if p[2])
+    points = points[start:] + points[:start]
+    path = [points[0][:2]]
+    i = 1
+    while i <= len(points):
+        x, y, on = points[i % len(points)]
+        if on:
+            path.append((x, y))
+            i += 1
+            continue
+        ex, ey, _ = points[(i + 1) % len(points)]
+        sx, sy = path[-1]
+        for k in range(1, steps + 1):
+            t = k / float(steps)
+            u = 1 - t
+            path.append((u * u * sx + 2 * u * t * x + t * t * ex, u * u * sy + 2 * u * t * y + t * t * ey))
+        i += 2
+    return path
+
+
+def rasterize(edges, width, height):
+    """Coverage 0..15 per pixel of edges given in pixel coordinates, y down."""
+    hits = [[0] * (width * SUB) for _ in range(height)]
+    for sy in range(height * SUB):
+        y = (sy + 0.5) / SUB
+        crossings = []
+        for x0, y0, x1, y1 in edges:
+            if (y0 <= y < y1) or (y1 <= y < y0):
+                crossings.append((x0 + (y - y0) * (x1 - x0) / (y1 - y0), 1 if y1 > y0 else -1))
+        crossings.sort()
+        winding = 0
+        row = hits[sy // SUB]
+        for i, (x, direction) in enumerate(crossings):
+            winding += direction
+            if winding and i + 1 < len(crossings):
+                a = max(0, int(x * SUB + 0.5))
+                b = min(width * SUB, int(crossings[i + 1][0] * SUB + 0.5))
+                for sx in range(a, b):
+                    row[sx] += 1
+    cover = []
+    for row in hits:
+        cover.append([(sum(row[x * SUB:(x + 1) * SUB]) * 15 + SUB * SUB // 2) // (SUB * SUB) for x in range(width)])
+    return cover
+
+
+def main():
+    if len(sys.argv) != 5:
+        sys.exit(__doc__)
+    path, width, height, name = sys.argv[1], int(sys.argv[2]), int(sys.argv[3]), sys.argv[4]
+    font = TrueType(path)
+    glyphs = {code: font.cmap.get(code, 0) for code in range(FIRST, LAST + 1)}
+    outlines = {code: font.contours(g) for code, g in glyphs.items()}
+    ys = [y for o in outlines.values() for c in o for _, y, _ in c]
+    advance = max(font.advance(g) for g in glyphs.values())
+    scale = min(width / float(advance), height / float(max(ys) - min(ys)))
+    baseline = (height - (max(ys) - min(ys)) * scale) / 2 + max(ys) * scale
+
+    stride = (width + 1) // 2
+    lines = [
+        "// Generated by tools/fontgen.py %s %d %d %s, do not edit." % (os.path.basename(path), width, height, name),
+        "// DejaVu and Bitstream Vera fonts may be embedded, see their LICENSE.",
+        "#include <stddef.h>",
+        "",
+        '#include "font.h"',
+        "",
+        "static const u08 %s [] = {" % name.replace("_", ""),
+    ]
+    for code, glyph in glyphs.items():
+        left = (width - font.advance(glyph) * scale) / 2
+        edges = []
+        for outline in outlines[code]:
+            pts = [(left + x * scale, baseline - y * scale) for x, y in flatten(outline)]
+            edges += [pts[i] + pts[(i + 1) % len(pts)] for i in range(len(pts))]
+        cover = rasterize(edges, width, height)
+        lines.append("// '%s'" % chr(code))
+        for row in cover:
+            row = row + [0] * (2 * stride - width)
+            lines.append(", ".join("0x%02X" % ((row[i] << 4) | row[i + 1]) for i in range(0, len(row), 2)) + ",")
+    lines += [
+        "};",
+        "",
+        "FontDef %s = {%d,%d,NULL,%s};" % (name, width, height, name.replace("_", "")),
+        "",
+    ]
+    sys.stdout.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,68 @@
+#!/usr/bin/env python3
+"""Decode the binary log records written by logring.c.
+
+Usage: logdecode.py [/dev/ttyACM0 | capture.bin] [path/to/logring.h]
+
+Bytes outside of log frames (plain printf output) are passed through as text.
+"""
+import os
+import re
+import struct
+import sys
+
+SYNC = b"\x55\xAA"
+RECORD = struct.Struct("<IHBBIII")
+
+
+def load_formats(header):
+    with open(header) as f:
+        text = f.read()
+    return [fmt for _, fmt in re.findall(r'X\((\w+),\s*"((?:[^"\\]|\\.)*)"\)', text)]
+
+
+def render(formats, record):
+    timestamp, fmt_id, core, argc, arg0, arg1, arg2 = record
+    if fmt_id >= len(formats):
+        return None
+    text = formats[fmt_id].replace("%u", "%d")
+    return "[%10u us core%u] %s" % (timestamp, core, text % (arg0, arg1, arg2)[:argc])
+
+
+def decode(stream, formats, out=sys.stdout):
+    buf = b""
+    while True:
+        chunk = stream.read(256)
+        if not chunk:
+            break
+        buf += chunk
+        while True:
+            pos = buf.find(SYNC)
+            if pos < 0:
+                keep = 1 if buf.endswith(SYNC[:1]) else 0
+                out.write(buf[:len(buf) - keep].decode("utf-8", "replace"))
+                buf = buf[len(buf) - keep:]
+                break
+            out.write(buf[:pos].decode("utf-8", "replace"))
+            if len(buf) < pos + len(SYNC) + RECORD.size:
+                buf = buf[pos:]
+                break
+            line = render(formats, RECORD.unpack_from(buf, pos + len(SYNC)))
+            if line is None:
+                out.write(buf[pos:pos + 1].decode("utf-8", "replace"))
+                buf = buf[pos + 1:]
+                continue
+            out.write(line + "\n")
+            buf = buf[pos + len(SYNC) + RECORD.size:]
+        out.flush()
+
+
+def main():
+    source = sys.argv[1] if len(sys.argv) > 1 else "/dev/ttyACM0"
+    header = sys.argv[2] if len(sys.argv) > 2 else \
+        os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "logring.h")
+    with open(source, "rb", buffering=0) as stream:
+        decode(stream, load_formats(header))
+
+
+if __name__ == "__main__":
+    main()
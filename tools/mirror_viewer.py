@@ -0,0 +1,174 @@
+#!/usr/bin/env python3
+"""Show the panel drawing streamed by st7789/mirror.c (DISPLAY_MIRROR builds).
+
+Usage: mirror_viewer.py [/dev/ttyACM0 | capture.bin] [zoom]
+
+Log records from logring.c share the port, they are skipped here, use
+logdecode.py on a capture to read them.
+"""
+import struct
+import sys
+import threading
+
+MIRROR_SYNC = b"\xA5\x5A"
+LOG_SYNC = b"\x55\xAA"
+LOG_RECORD = 16
+FRAME = struct.Struct("<BH")
+
+
+class Mirror:
+    """Replays mirror frames into an RGB565 framebuffer."""
+
+    def __init__(self, width=240, height=240):
+        self.lock = threading.Lock()
+        self.frames = 0
+        self.lost = 0
+        self.seq = None
+        self.resize(width, height)
+        self.window = (0, 0, 0, 0)
+        self.x = self.y = 0
+
+    def resize(self, width, height):
+        if getattr(self, "width", None) == width and getattr(self, "height", None) == height:
+            return
+        self.width, self.height = width, height
+        self.pixels = [0] * (width * height)
+        self.dirty = set(range(height))
+
+    def put(self, pixel):
+        if self.x < self.width and self.y < self.height:
+            self.pixels[self.y * self.width + self.x] = pixel
+            self.dirty.add(self.y)
+        self.skip(1)
+
+    def skip(self, count):
+        x0, y0, x1, y1 = self.window
+        span = x1 - x0 + 1
+        pos = (self.y - y0) * span + (self.x - x0) + count
+        self.y = y0 + (pos // span) % (y1 - y0 + 1)
+        self.x = x0 + pos % span
+
+    def apply(self, ops):
+        i = 0
+        while i < len(ops):
+            op = chr(ops[i])
+            if op == "S":
+                self.resize(*struct.unpack_from("<HH", ops, i + 1))
+                i += 5
+            elif op == "W":
+                x0, y0, x1, y1 = struct.unpack_from("<HHHH", ops, i + 1)
+                self.window = (x0, y0, max(x0, x1), max(y0, y1))
+                self.x, self.y = x0, y0
+                i += 9
+            elif op == "A":
+                self.skip(struct.unpack_from("<I", ops, i + 1)[0])
+                i += 5
+            elif op == "R":
+                count, pixel = struct.unpack_from("<HH", ops, i + 1)
+                for _ in range(count):
+                    self.put(pixel)
+                i += 5
+            elif op == "L":
+                count = struct.unpack_from("<H", ops, i + 1)[0]
+                for pixel in struct.unpack_from("<%dH" % count, ops, i + 3):
+                    self.put(pixel)
+                i += 3 + count * 2
+            elif op == "D":
+                size, times = struct.unpack_from("<HH", ops, i + 1)
+                for _ in range(times):
+                    self.apply(ops[i - size:i])
+                i += 5
+            elif op == "M":
+                count, color, bgcolor, bits = struct.unpack_from("<BHHI", ops, i + 1)
+                for _ in range(count):
+                    self.put(color if bits & 0x80000000 else bgcolor)
+                    bits = (bits << 1) & 0xFFFFFFFF
+                i += 10
+            else:
+                return False  # corrupt frame, wait for the next sync
+        return True
+
+    def feed(self, buf):
+        """Consumes complete frames from buf and returns the unused tail."""
+        pos = 0
+        while True:
+            start = buf.find(MIRROR_SYNC, pos)
+            log = buf.find(LOG_SYNC, pos)
+            if 0 <= log < start or (start < 0 and log >= 0):
+                if len(buf) < log + len(LOG_SYNC) + LOG_RECORD:
+                    return buf[log:]
+                pos = log + len(LOG_SYNC) + LOG_RECORD
+                continue
+            if start < 0:
+                return buf[-1:]
+            if len(buf) < start + len(MIRROR_SYNC) + FRAME.size:
+                return buf[start:]
+            seq, length = FRAME.unpack_from(buf, start + len(MIRROR_SYNC))
+            ops = start + len(MIRROR_SYNC) + FRAME.size
+            if len(buf) < ops + length:
+                return buf[start:]
+            with self.lock:
+                if self.seq is not None and seq != (self.seq + 1) & 0xFF:
+                    self.lost += (seq - self.seq - 1) & 0xFF
+                self.seq = seq
+                if self.apply(buf[ops:ops + length]):
+                    self.frames += 1
+            pos = ops + length
+
+    def rgb(self, y):
+        out = []
+        for p in self.pixels[y * self.width:(y + 1) * self.width]:
+            r, g, b = (p >> 11) & 0x1F, (p >> 5) & 0x3F, p & 0x1F
+            out.append("#%02x%02x%02x" % (r << 3 | r >> 2, g << 2 | g >> 4, b << 3 | b >> 2))
+        return out
+
+
+def read(stream, mirror):
+    buf = b""
+    while True:
+        chunk = stream.read(4096)
+        if not chunk:
+            break
+        buf = mirror.feed(buf + chunk)
+
+
+def main():
+    import tkinter
+
+    source = sys.argv[1] if len(sys.argv) > 1 else "/dev/ttyACM0"
+    zoom = int(sys.argv[2]) if len(sys.argv) > 2 else 2
+    mirror = Mirror()
+    stream = open(source, "rb", buffering=0)
+    threading.Thread(target=read, args=(stream, mirror), daemon=True).start()
+
+    root = tkinter.Tk()
+    root.title("st7789 mirror - " + source)
+    image = tkinter.PhotoImage(width=mirror.width, height=mirror.height)
+    view = tkinter.Label(root)
+    view.pack()
+    status = tkinter.Label(root, anchor="w")
+    status.pack(fill="x")
+    state = {"image": image, "zoomed": image.zoom(zoom)}
+
+    def refresh():
+        with mirror.lock:
+            if state["image"].width() != mirror.width or state["image"].height() != mirror.height:
+                state["image"] = tkinter.PhotoImage(width=mirror.width, height=mirror.height)
+                mirror.dirty = set(range(mirror.height))
+            rows = {y: mirror.rgb(y) for y in mirror.dirty}
+            mirror.dirty = set()
+            text = "%d frames, %d lost" % (mirror.frames, mirror.lost)
+        for y, row in rows.items():
+            state["image"].put("{" + " ".join(row) + "}", to=(0, y))
+        if rows:
+            state["zoomed"] = state["image"].zoom(zoom)
+            view.configure(image=state["zoomed"])
+        status.configure(text=text)
+        root.after(50, refresh)
+
+    refresh()
+    root.mainloop()
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,317 @@
+#include "widgets.h"
+
+#include <string.h>
+
+#include "femtox/String.h"
+
+#ifndef MIN
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+#endif
+
+#define REDRAW_NONE 0
+#define REDRAW_TEXT 1 // same geometry and colors, only changed characters
+#define REDRAW_FULL 2
+
+static u16 resolveColor(WidgetLayer_t* layer, WidgetColor_t color) {
+    return (color & WIDGET_FIXED) ? (u16)color : layer->theme[color];
+}
+
+static Rect_t widgetBounds(const Widget_t* widget) {
+    Rect_t r = {widget->x, widget->y, widget->w, widget->h};
+    if(widget->kind == WIDGET_LABEL) {
+        r.w = strlen(widget->text) * widget->font->width * widget->scale;
+        r.h = widget->font->height * widget->scale;
+    } else if(widget->kind == WIDGET_NUMBER) {
+        r.w = widget->cells * widget->font->width * widget->scale;
+        r.h = widget->font->height * widget->scale;
+    }
+    return r;
+}
+
+static bool_t rectEmpty(Rect_t r) {
+    return r.w == 0 || r.h == 0;
+}
+
+static bool_t rectEqual(Rect_t a, Rect_t b) {
+    return a.x == b.x && a.y == b.y && a.w == b.w && a.h == b.h;
+}
+
+// overlapping or touching, merging those never adds pixels that were not damaged or adjacent
+static bool_t rectTouch(Rect_t a, Rect_t b) {
+    return a.x <= b.x + b.w && b.x <= a.x + a.w && a.y <= b.y + b.h && b.y <= a.y + a.h;
+}
+
+static bool_t rectIntersect(Rect_t a, Rect_t b) {
+    return a.x < b.x + b.w && b.x < a.x + a.w && a.y < b.y + b.h && b.y < a.y + a.h;
+}
+
+static Rect_t rectUnion(Rect_t a, Rect_t b) {
+    u16 x1 = MAX(a.x + a.w, b.x + b.w);
+    u16 y1 = MAX(a.y + a.h, b.y + b.h);
+    Rect_t r = {MIN(a.x, b.x), MIN(a.y, b.y), 0, 0};
+    r.w = x1 - r.x;
+    r.h = y1 - r.y;
+    return r;
+}
+
+typedef struct {
+    Rect_t rects[WIDGET_DAMAGE_MAX];
+    u08 count;
+} Damage_t;
+
+static void addDamage(Damage_t* damage, Rect_t r) {
+    if(rectEmpty(r)) return;
+    for(u08 i = 0; i < damage->count;) {
+        if(rectTouch(damage->rects[i], r)) {
+            r = rectUnion(damage->rects[i], r);
+            damage->rects[i] = damage->rects[--damage->count];
+            i = 0; // the grown rectangle may now touch an earlier one
+            continue;
+        }
+        i++;
+    }
+    if(damage->count == WIDGET_DAMAGE_MAX) {
+        r = rectUnion(damage->rects[--damage->count], r);
+    }
+    damage->rects[damage->count++] = r;
+}
+
+static bool_t damaged(const Damage_t* damage, Rect_t r) {
+    for(u08 i = 0; i < damage->count; i++) {
+        if(rectIntersect(damage->rects[i], r)) return TRUE;
+    }
+    return FALSE;
+}
+
+// All clears of a render go out with one kick when the panel has a display list
+// transport, the widgets drawn next wait for them in the driver.
+static void clearDamage(WidgetLayer_t* layer, const Damage_t* damage, u16 background) {
+    struct st7789* lcd = layer->lcd;
+    st7789_dlist_wait(lcd); // the previous clears may still be sent from the same storage
+    st7789_dlist_begin(&layer->clears, layer->clearBuf, WIDGET_CLEAR_HALFWORDS, layer->clearBlocks, WIDGET_CLEAR_BLOCKS);
+    for(u08 d = 0; d < damage->count; d++) {
+        Rect_t r = damage->rects[d];
+        if(r.x >= lcd->width || r.y >= lcd->height) continue;
+        st7789_dlist_rect(&layer->clears, r.x, r.y, MIN(r.w, lcd->width - r.x), MIN(r.h, lcd->height - r.y), background);
+        layer->drawOps++;
+    }
+    if(st7789_dlist_end(&layer->clears)) st7789_dlist_replay(lcd, &layer->clears);
+}
+
+static void drawText(WidgetLayer_t* layer, Widget_t* widget, u08 from, u08 to, u16 fg, u16 bg) {
+    char run[WIDGET_TEXT_LEN + 1];
+    memcpy(run, widget->text + from, to - from);
+    run[to - from] = END_STRING;
+    st7789_write_string(layer->lcd, widget->x + from * widget->font->width * widget->scale, widget->y, run, *widget->font, widget->scale, fg, bg);
+    layer->drawOps++;
+}
+
+static void drawWidget(WidgetLayer_t* layer, Widget_t* widget, u08 mode) {
+    u16 fg = resolveColor(layer, widget->fg);
+    u16 bg = resolveColor(layer, widget->bg);
+    Rect_t r = widgetBounds(widget);
+    switch(widget->kind) {
+        case WIDGET_BOX:
+            st7789_draw_filled_rectangle(layer->lcd, r.x, r.y, r.w, r.h, fg);
+            layer->drawOps++;
+            break;
+        case WIDGET_BITMAP:
+            st7789_select_window(layer->lcd, r.x, r.y, r.x + r.w - 1, r.y + r.h - 1);
+            st7789_write_pixels(layer->lcd, widget->pixels, (u32)r.w * r.h);
+            layer->drawOps++;
+            break;
+        default:
+            if(mode == REDRAW_FULL) {
+                if(widget->text[0] != END_STRING) drawText(layer, widget, 0, strlen(widget->text), fg, bg);
+                break;
+            }
+            // same length as shown, rewrite only the runs of changed characters
+            for(u08 i = 0; widget->text[i] != END_STRING;) {
+                if(widget->text[i] == widget->shownText[i]) {
+                    i++;
+                    continue;
+                }
+                u08 end = i + 1;
+                while(widget->text[end] != END_STRING && widget->text[end] != widget->shownText[end]) end++;
+                drawText(layer, widget, i, end, fg, bg);
+                i = end;
+            }
+            break;
+    }
+    widget->drawn = TRUE;
+    widget->shown = r;
+    widget->shownFg = fg;
+    widget->shownBg = bg;
+    widget->shownPixels = widget->pixels;
+    strcpy(widget->shownText, widget->text);
+}
+
+void widgetsRender(WidgetLayer_t* layer) {
+    mutex_enter_blocking(&layer->lock);
+    Damage_t damage = {.count = 0};
+    u08 redraw[WIDGET_LAYER_MAX];
+    u16 background = layer->theme[THEME_BACKGROUND];
+    bool_t fullScreen = !layer->backgroundDrawn || layer->shownBackground != background;
+    if(fullScreen) {
+        addDamage(&damage, (Rect_t){0, 0, layer->lcd->width, layer->lcd->height});
+    }
+
+    for(u08 i = 0; i < layer->count; i++) {
+        Widget_t* widget = layer->widgets[i];
+        Rect_t r = widgetBounds(widget);
+        redraw[i] = REDRAW_NONE;
+        if(!widget->visible) {
+            if(widget->drawn) addDamage(&damage, widget->shown);
+            widget->drawn = FALSE;
+            continue;
+        }
+        if(!widget->drawn || !rectEqual(r, widget->shown)) {
+            if(widget->drawn) addDamage(&damage, widget->shown);
+            redraw[i] = REDRAW_FULL;
+        } else if(resolveColor(layer, widget->fg) != widget->shownFg ||
+                  resolveColor(layer, widget->bg) != widget->shownBg ||
+                  widget->pixels != widget->shownPixels) {
+            redraw[i] = REDRAW_FULL;
+        } else if(widget->kind != WIDGET_BOX && widget->kind != WIDGET_BITMAP &&
+                  strcmp(widget->text, widget->shownText)) {
+            redraw[i] = REDRAW_TEXT;
+        }
+    }
+
+    clearDamage(layer, &damage, background);
+
+    // widgets under cleared damage lose their pixels, and anything stacked on
+    // top of a redrawn widget has to be drawn again after it
+    for(u08 i = 0; i < layer->count; i++) {
+        Widget_t* widget = layer->widgets[i];
+        if(!widget->visible || redraw[i] == REDRAW_FULL) continue;
+        Rect_t r = widgetBounds(widget);
+        if(damaged(&damage, r)) {
+            redraw[i] = REDRAW_FULL;
+            continue;
+        }
+        for(u08 j = 0; j < i; j++) {
+            if(redraw[j] != REDRAW_NONE && rectIntersect(widgetBounds(layer->widgets[j]), r)) {
+                redraw[i] = REDRAW_FULL;
+                break;
+            }
+        }
+    }
+
+    for(u08 i = 0; i < layer->count; i++) {
+        if(redraw[i] != REDRAW_NONE) drawWidget(layer, layer->widgets[i], redraw[i]);
+    }
+    layer->backgroundDrawn = TRUE;
+    layer->shownBackground = background;
+    mutex_exit(&layer->lock);
+}
+
+void widgetsInvalidate(WidgetLayer_t* layer) {
+    mutex_enter_blocking(&layer->lock);
+    layer->backgroundDrawn = FALSE;
+    mutex_exit(&layer->lock);
+}
+
+void widgetLayerInit(WidgetLayer_t* layer, struct st7789* lcd) {
+    layer->lcd = lcd;
+    mutex_init(&layer->lock);
+    layer->count = 0;
+    layer->backgroundDrawn = FALSE;
+    layer->drawOps = 0;
+    layer->theme[THEME_BACKGROUND] = ST_COLOR_BLACK;
+    layer->theme[THEME_FOREGROUND] = ST_COLOR_WHITE;
+    layer->theme[THEME_ACCENT] = ST_COLOR_RED;
+}
+
+bool_t widgetAdd(WidgetLayer_t* layer, Widget_t* widget) {
+    mutex_enter_blocking(&layer->lock);
+    bool_t added = layer->count < WIDGET_LAYER_MAX;
+    if(added) layer->widgets[layer->count++] = widget;
+    mutex_exit(&layer->lock);
+    return added;
+}
+
+void themeSet(WidgetLayer_t* layer, ThemeSlot_t slot, u16 color) {
+    layer->theme[slot] = color;
+}
+
+u16 themeGet(WidgetLayer_t* layer, ThemeSlot_t slot) {
+    return layer->theme[slot];
+}
+
+static void widgetInit(Widget_t* widget, u08 kind, u16 x, u16 y, WidgetColor_t fg, WidgetColor_t bg) {
+    memset(widget, 0, sizeof(Widget_t));
+    widget->kind = kind;
+    widget->visible = TRUE;
+    widget->x = x;
+    widget->y = y;
+    widget->fg = fg;
+    widget->bg = bg;
+}
+
+void widgetLabel(Widget_t* widget, u16 x, u16 y, const FontDef* font, u08 scale, WidgetColor_t fg, WidgetColor_t bg) {
+    widgetInit(widget, WIDGET_LABEL, x, y, fg, bg);
+    widget->font = font;
+    widget->scale = font->aa ? 1 : scale; // anti-aliased fonts are drawn unscaled
+}
+
+void widgetNumber(Widget_t* widget, u16 x, u16 y, u08 cells, const FontDef* font, u08 scale, WidgetColor_t fg, WidgetColor_t bg) {
+    widgetInit(widget, WIDGET_NUMBER, x, y, fg, bg);
+    widget->font = font;
+    widget->scale = font->aa ? 1 : scale;
+    widget->cells = MIN(cells, WIDGET_TEXT_LEN);
+    memset(widget->text, ' ', widget->cells);
+}
+
+void widgetBox(Widget_t* widget, u16 x, u16 y, u16 w, u16 h, WidgetColor_t color) {
+    widgetInit(widget, WIDGET_BOX, x, y, color, color);
+    widget->w = w;
+    widget->h = h;
+}
+
+void widgetBitmap(Widget_t* widget, u16 x, u16 y, u16 w, u16 h, const u16* pixels) {
+    widgetInit(widget, WIDGET_BITMAP, x, y, THEME_COLOR(THEME_BACKGROUND), THEME_COLOR(THEME_BACKGROUND));
+    widget->w = w;
+    widget->h = h;
+    widget->pixels = pixels;
+}
+
+void widgetSetText(WidgetLayer_t* layer, Widget_t* widget, const char* text) {
+    mutex_enter_blocking(&layer->lock);
+    strncpy(widget->text, text, WIDGET_TEXT_LEN);
+    widget->text[WIDGET_TEXT_LEN] = END_STRING;
+    mutex_exit(&layer->lock);
+}
+
+void widgetSetNumber(WidgetLayer_t* layer, Widget_t* widget, s32 value) {
+    char digits[12];
+    toStringDec(value, digits);
+    u08 len = strlen(digits);
+    u08 skip = len > widget->cells ? len - widget->cells : 0;
+    mutex_enter_blocking(&layer->lock);
+    u08 pad = widget->cells - (len - skip);
+    memset(widget->text, ' ', pad);
+    strcpy(widget->text + pad, digits + skip);
+    mutex_exit(&layer->lock);
+}
+
+void widgetSetColors(WidgetLayer_t* layer, Widget_t* widget, WidgetColor_t fg, WidgetColor_t bg) {
+    mutex_enter_blocking(&layer->lock);
+    widget->fg = fg;
+    widget->bg = bg;
+    mutex_exit(&layer->lock);
+}
+
+void widgetMove(WidgetLayer_t* layer, Widget_t* widget, u16 x, u16 y) {
+    mutex_enter_blocking(&layer->lock);
+    widget->x = x;
+    widget->y = y;
+    mutex_exit(&layer->lock);
+}
+
+void widgetSetVisible(WidgetLayer_t* layer, Widget_t* widget, bool_t visible) {
+    mutex_enter_blocking(&layer->lock);
+    widget->visible = visible;
+    mutex_exit(&layer->lock);
+}
@@ -0,0 +1,95 @@
+#ifndef WIDGETS_H_
+#define WIDGETS_H_
+
+#include <pico/sync.h>
+
+#include "st7789/st7789.h"
+#include "st7789/dlist.h"
+
+#define WIDGET_TEXT_LEN 20
+#define WIDGET_LAYER_MAX 16
+#define WIDGET_DAMAGE_MAX 8
+// a cleared rectangle is a window and at most two fill entries of two blocks each
+#define WIDGET_CLEAR_HALFWORDS (WIDGET_DAMAGE_MAX * (ST7789_DLIST_WINDOW + 4))
+#define WIDGET_CLEAR_BLOCKS (WIDGET_DAMAGE_MAX * 4 + 2) // and the end of the chain
+
+// Widget colors are either a theme slot or a fixed RGB565 color, so a theme
+// change is one property update that redraws exactly the widgets using it.
+typedef enum {
+    THEME_BACKGROUND, // also the screen background
+    THEME_FOREGROUND,
+    THEME_ACCENT,
+    THEME_SLOTS
+} ThemeSlot_t;
+
+typedef u32 WidgetColor_t;
+#define WIDGET_FIXED 0x10000
+#define THEME_COLOR(slot) ((WidgetColor_t)(slot))
+#define FIXED_COLOR(rgb)  ((WidgetColor_t)(rgb) | WIDGET_FIXED)
+
+typedef enum {
+    WIDGET_LABEL,
+    WIDGET_BOX,
+    WIDGET_BITMAP,
+    WIDGET_NUMBER // right aligned decimal in a fixed number of character cells
+} WidgetKind_t;
+
+typedef struct {
+    u16 x, y, w, h;
+} Rect_t;
+
+typedef struct {
+    // properties, change them only through the widget* setters
+    u08 kind;
+    bool_t visible;
+    u16 x, y;
+    u16 w, h;        // box and bitmap size, labels take it from font and text
+    WidgetColor_t fg, bg;
+    const FontDef* font;
+    u08 scale;       // glyph magnification for labels and numbers
+    const u16* pixels;
+    u08 cells;       // WIDGET_NUMBER width in characters
+    char text[WIDGET_TEXT_LEN + 1];
+
+    // last rendered state
+    bool_t drawn;
+    Rect_t shown;
+    u16 shownFg, shownBg;
+    const u16* shownPixels;
+    char shownText[WIDGET_TEXT_LEN + 1];
+} Widget_t;
+
+typedef struct {
+    struct st7789* lcd;
+    mutex_t lock;
+    Widget_t* widgets[WIDGET_LAYER_MAX]; // in z-order, later widgets are on top
+    u08 count;
+    u16 theme[THEME_SLOTS];
+    bool_t backgroundDrawn;
+    u16 shownBackground;
+    u32 drawOps; // st7789 draw operations issued, for profiling
+    struct st7789_dlist clears; // damage clears of the last render, sent as one display list
+    u16 clearBuf[WIDGET_CLEAR_HALFWORDS];
+    struct st7789_dlist_block clearBlocks[WIDGET_CLEAR_BLOCKS];
+} WidgetLayer_t;
+
+void widgetLayerInit(WidgetLayer_t* layer, struct st7789* lcd);
+bool_t widgetAdd(WidgetLayer_t* layer, Widget_t* widget);
+void widgetsRender(WidgetLayer_t* layer); // emits the minimal redraw for all changes since the last call
+void widgetsInvalidate(WidgetLayer_t* layer); // the next render draws the whole screen again
+
+void themeSet(WidgetLayer_t* layer, ThemeSlot_t slot, u16 color);
+u16 themeGet(WidgetLayer_t* layer, ThemeSlot_t slot);
+
+void widgetLabel(Widget_t* widget, u16 x, u16 y, const FontDef* font, u08 scale, WidgetColor_t fg, WidgetColor_t bg);
+void widgetNumber(Widget_t* widget, u16 x, u16 y, u08 cells, const FontDef* font, u08 scale, WidgetColor_t fg, WidgetColor_t bg);
+void widgetBox(Widget_t* widget, u16 x, u16 y, u16 w, u16 h, WidgetColor_t color);
+void widgetBitmap(Widget_t* widget, u16 x, u16 y, u16 w, u16 h, const u16* pixels);
+
+void widgetSetText(WidgetLayer_t* layer, Widget_t* widget, const char* text);
+void widgetSetNumber(WidgetLayer_t* layer, Widget_t* widget, s32 value);
+void widgetSetColors(WidgetLayer_t* layer, Widget_t* widget, WidgetColor_t fg, WidgetColor_t bg);
+void widgetMove(WidgetLayer_t* layer, Widget_t* widget, u16 x, u16 y);
+void widgetSetVisible(WidgetLayer_t* layer, Widget_t* widget, bool_t visible);
+
+#endif /*WIDGETS_H_*/